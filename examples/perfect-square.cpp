@@ -216,7 +216,7 @@ public:
     IntArgs sa(n,s);
 
     // Squares do not overlap
-    nooverlap(*this, x, sa, y, sa);
+    nooverlap(*this, x, sa, y, sa, opt.icl());
 
     /*
      * Capacity constraints
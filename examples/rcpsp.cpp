@@ -0,0 +1,153 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+#include <gecode/minimodel.hh>
+
+using namespace Gecode;
+
+/**
+ * \brief %Example: Resource-constrained project scheduling
+ *
+ * Schedule jobs with precedences on several cumulative resources
+ * such that the makespan is minimal. The instances are generated
+ * randomly in the style of the PSPLIB generator: every job has a
+ * duration between 1 and 10, requires each of four resources with
+ * probability one half, and has between one and three predecessors
+ * among the ten previous jobs. The number of jobs is given by the
+ * size of the instance.
+ *
+ * Use the option <code>-icl dom</code> to also perform time-table
+ * edge-finding for the cumulative constraints.
+ *
+ * \ingroup Example
+ *
+ */
+class RCPSP : public IntMinimizeScript {
+protected:
+  /// Number of resources
+  static const int n_res = 4;
+  /// Start times of jobs
+  IntVarArray s;
+  /// Makespan
+  IntVar makespan;
+public:
+  /// Actual model
+  RCPSP(const SizeOptions& opt)
+    : s(*this,opt.size()) {
+    int n = opt.size();
+    Support::RandomGenerator rnd(static_cast<unsigned int>(n));
+
+    // Durations
+    IntArgs p(n);
+    int h = 0;
+    for (int i=0; i<n; i++) {
+      p[i] = 1 + static_cast<int>(rnd(10U));
+      h += p[i];
+    }
+    for (int i=0; i<n; i++)
+      s[i] = IntVar(*this,0,h-p[i]);
+    makespan = IntVar(*this,0,h);
+
+    // Precedences
+    for (int i=1; i<n; i++) {
+      int m = 1 + static_cast<int>(rnd(3U));
+      for (int k=0; k<m; k++) {
+        int w = std::min(i,10);
+        int j = i - 1 - static_cast<int>(rnd(static_cast<unsigned int>(w)));
+        rel(*this, s[j] + p[j] <= s[i]);
+      }
+    }
+    for (int i=0; i<n; i++)
+      rel(*this, s[i] + p[i] <= makespan);
+
+    // Resources
+    for (int r=0; r<n_res; r++) {
+      IntArgs u(n);
+      int u_max = 0, u_sum = 0;
+      for (int i=0; i<n; i++) {
+        u[i] = (rnd(2U) == 0) ? 0 : 1 + static_cast<int>(rnd(10U));
+        u_max = std::max(u_max,u[i]);
+        u_sum += u[i];
+      }
+      int c = std::max(u_max, u_sum / 4);
+      cumulative(*this, c, s, p, u, opt.icl());
+    }
+
+    branch(*this, s, INT_VAR_MIN_MIN(), INT_VAL_MIN());
+    assign(*this, makespan, INT_ASSIGN_MIN());
+  }
+  /// Constructor for cloning \a r
+  RCPSP(bool share, RCPSP& r) : IntMinimizeScript(share,r) {
+    s.update(*this, share, r.s);
+    makespan.update(*this, share, r.makespan);
+  }
+  /// Perform copying during cloning
+  virtual Space*
+  copy(bool share) {
+    return new RCPSP(share,*this);
+  }
+  /// Minimize the makespan
+  virtual IntVar
+  cost(void) const {
+    return makespan;
+  }
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    os << "\tStart times: " << s << std::endl
+       << "\tMakespan: " << makespan << std::endl;
+  }
+};
+
+/** \brief Main-function
+ *  \relates RCPSP
+ */
+int
+main(int argc, char* argv[]) {
+  SizeOptions opt("RCPSP");
+  opt.size(30);
+  opt.solutions(0);
+  opt.icl(ICL_DEF);
+  opt.parse(argc,argv);
+  IntMinimizeScript::run<RCPSP,BAB,SizeOptions>(opt);
+  return 0;
+}
+
+// STATISTICS: example-any
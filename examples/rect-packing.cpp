@@ -0,0 +1,134 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+#include <gecode/minimodel.hh>
+
+#include <cmath>
+
+using namespace Gecode;
+
+/**
+ * \brief %Example: Packing rectangles into a square
+ *
+ * Pack rectangles without overlap into a square. The instances are
+ * generated randomly: every rectangle has a width and a height between
+ * 1 and 10, and the side of the square is chosen such that the
+ * rectangles cover about 60% of its area. The number of rectangles is
+ * given by the size of the instance.
+ *
+ * The example is meant to show how the no-overlap constraint scales
+ * with the number of rectangles. Use the option <code>-icl bnd</code>
+ * to use sweep-based propagation for the no-overlap constraint
+ * instead of pairwise propagation.
+ *
+ * \ingroup Example
+ *
+ */
+class RectPacking : public Script {
+protected:
+  /// x-coordinates of rectangles
+  IntVarArray x;
+  /// y-coordinates of rectangles
+  IntVarArray y;
+public:
+  /// Actual model
+  RectPacking(const SizeOptions& opt)
+    : x(*this,opt.size()), y(*this,opt.size()) {
+    int n = opt.size();
+    Support::RandomGenerator rnd(static_cast<unsigned int>(n));
+
+    // Widths and heights
+    IntArgs w(n), h(n);
+    int a = 0;
+    for (int i=0; i<n; i++) {
+      w[i] = 1 + static_cast<int>(rnd(10U));
+      h[i] = 1 + static_cast<int>(rnd(10U));
+      a += w[i]*h[i];
+    }
+    int l = static_cast<int>(std::ceil(std::sqrt(a / 0.6)));
+    for (int i=0; i<n; i++) {
+      x[i] = IntVar(*this,0,l-w[i]);
+      y[i] = IntVar(*this,0,l-h[i]);
+    }
+
+    nooverlap(*this, x, w, y, h, opt.icl());
+
+    // Place rectangles with larger area first, bottom-left
+    IntArgs o(IntArgs::create(n,0));
+    for (int i=1; i<n; i++)
+      for (int j=i; (j > 0) && (w[o[j]]*h[o[j]] > w[o[j-1]]*h[o[j-1]]); j--)
+        std::swap(o[j],o[j-1]);
+    IntVarArgs yx;
+    for (int i=0; i<n; i++)
+      yx << y[o[i]] << x[o[i]];
+    branch(*this, yx, INT_VAR_NONE(), INT_VAL_MIN());
+  }
+  /// Constructor for cloning \a s
+  RectPacking(bool share, RectPacking& s) : Script(share,s) {
+    x.update(*this, share, s.x);
+    y.update(*this, share, s.y);
+  }
+  /// Perform copying during cloning
+  virtual Space*
+  copy(bool share) {
+    return new RectPacking(share,*this);
+  }
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    os << "\tx: " << x << std::endl
+       << "\ty: " << y << std::endl;
+  }
+};
+
+/** \brief Main-function
+ *  \relates RectPacking
+ */
+int
+main(int argc, char* argv[]) {
+  SizeOptions opt("RectPacking");
+  opt.size(50);
+  opt.icl(ICL_DEF);
+  opt.parse(argc,argv);
+  Script::run<RectPacking,DFS,SizeOptions>(opt);
+  return 0;
+}
+
+// STATISTICS: example-any
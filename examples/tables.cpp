@@ -0,0 +1,171 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+
+using namespace Gecode;
+
+/**
+ * \brief %Example: Random and structured table constraints
+ *
+ * A chain of table constraints with overlapping scopes: each
+ * table constraint is posted on four consecutive variables
+ * (cyclically). The tables are either random (each table has
+ * as many tuples as given by the size) or structured (all tuples
+ * of pairwise distinct values whose sum is divisible by the
+ * domain size).
+ *
+ * The example is meant to compare the different extensional
+ * propagators for tuple sets.
+ *
+ * \ingroup Example
+ *
+ */
+class Tables : public Script {
+protected:
+  /// Number of variables
+  static const int n = 30;
+  /// Domain size
+  static const int d = 20;
+  /// Arity of tables
+  static const int k = 4;
+  /// The variables
+  IntVarArray x;
+  /// Return random table with \a m tuples using random generator \a r
+  static TupleSet random(int m, Support::RandomGenerator& r) {
+    TupleSet t;
+    IntArgs tuple(k);
+    for (int i=0; i<m; i++) {
+      for (int j=0; j<k; j++)
+        tuple[j] = static_cast<int>(r(d));
+      t.add(tuple);
+    }
+    t.finalize();
+    return t;
+  }
+  /// Return structured table
+  static TupleSet structured(void) {
+    TupleSet t;
+    IntArgs tuple(k);
+    for (int a=0; a<d; a++)
+      for (int b=0; b<d; b++)
+        for (int c=0; c<d; c++)
+          for (int e=0; e<d; e++)
+            if ((a != b) && (a != c) && (a != e) && (b != c) && (b != e) &&
+                (c != e) && ((a+b+c+e) % d == 0)) {
+              tuple[0]=a; tuple[1]=b; tuple[2]=c; tuple[3]=e;
+              t.add(tuple);
+            }
+    t.finalize();
+    return t;
+  }
+public:
+  /// Model variants
+  enum {
+    MODEL_RANDOM,    ///< Random tables
+    MODEL_STRUCTURED ///< Structured tables
+  };
+  /// Propagation variants
+  enum {
+    PROPAGATION_MEMORY,  ///< Propagation optimized for memory
+    PROPAGATION_SPEED,   ///< Propagation optimized for speed
+    PROPAGATION_COMPACT  ///< Compact-table propagation
+  };
+  /// Actual model
+  Tables(const SizeOptions& opt)
+    : x(*this,n,0,d-1) {
+    ExtensionalPropKind epk;
+    switch (opt.propagation()) {
+    case PROPAGATION_MEMORY:  epk = EPK_MEMORY;  break;
+    case PROPAGATION_SPEED:   epk = EPK_SPEED;   break;
+    case PROPAGATION_COMPACT: epk = EPK_COMPACT; break;
+    default: GECODE_NEVER;
+    }
+    Support::RandomGenerator r(1);
+    TupleSet s = structured();
+    for (int i=0; i<n; i++) {
+      IntVarArgs y(k);
+      for (int j=0; j<k; j++)
+        y[j] = x[(i+j) % n];
+      if (opt.model() == MODEL_RANDOM)
+        extensional(*this, y, random(static_cast<int>(opt.size()),r), epk);
+      else
+        extensional(*this, y, s, epk);
+    }
+    branch(*this, x, INT_VAR_SIZE_MIN(), INT_VAL_MIN());
+  }
+  /// Constructor for cloning \a s
+  Tables(bool share, Tables& s) : Script(share,s) {
+    x.update(*this, share, s.x);
+  }
+  /// Copy during cloning
+  virtual Space*
+  copy(bool share) {
+    return new Tables(share,*this);
+  }
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    os << "\t" << x << std::endl;
+  }
+};
+
+/** \brief Main-function
+ *  \relates Tables
+ */
+int
+main(int argc, char* argv[]) {
+  SizeOptions opt("Tables");
+  opt.size(20000);
+  opt.model(Tables::MODEL_RANDOM);
+  opt.model(Tables::MODEL_RANDOM, "random", "use random tables");
+  opt.model(Tables::MODEL_STRUCTURED, "structured", "use structured tables");
+  opt.propagation(Tables::PROPAGATION_COMPACT);
+  opt.propagation(Tables::PROPAGATION_MEMORY, "memory",
+                  "use propagation optimized for memory");
+  opt.propagation(Tables::PROPAGATION_SPEED, "speed",
+                  "use propagation optimized for speed");
+  opt.propagation(Tables::PROPAGATION_COMPACT, "compact",
+                  "use compact-table propagation");
+  opt.parse(argc,argv);
+  Script::run<Tables,DFS,SizeOptions>(opt);
+  return 0;
+}
+
+// STATISTICS: example-any
@@ -640,6 +640,12 @@ AC_DEFUN([AC_GECODE_GCC_GENERAL_SWITCHES],
   AC_CHECK_FUNC([__builtin_ffsl],
     [AC_DEFINE([GECODE_HAS_BUILTIN_FFSL],[],
       [whether __builtin_ffsl is available])])
+  AC_CHECK_FUNC([__builtin_ctzl],
+    [AC_DEFINE([GECODE_HAS_BUILTIN_CTZL],[],
+      [whether __builtin_ctzl is available])])
+  AC_CHECK_FUNC([__builtin_popcountl],
+    [AC_DEFINE([GECODE_HAS_BUILTIN_POPCOUNTL],[],
+      [whether __builtin_popcountl is available])])
 
   AC_SUBST(docdir, "${datadir}/doc/gecode")
 
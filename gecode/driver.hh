@@ -333,6 +333,7 @@ namespace Gecode {
     Driver::StringOption _icl;         ///< Integer consistency level
     Driver::StringOption _branching;   ///< Branching options
     Driver::DoubleOption _decay;       ///< Decay option
+    Driver::BoolOption   _afc_schedule; ///< Schedule propagators by AFC
     //@}
     
     /// \name Search options
@@ -340,6 +341,8 @@ namespace Gecode {
     Driver::StringOption      _search;        ///< Search options
     Driver::UnsignedIntOption _solutions;     ///< How many solutions
     Driver::DoubleOption      _threads;       ///< How many threads to use
+    Driver::StringOption      _steal;         ///< How idle threads find work
+    Driver::UnsignedIntOption _assets;        ///< Number of portfolio assets
     Driver::UnsignedIntOption _c_d;           ///< Copy recomputation distance
     Driver::UnsignedIntOption _a_d;           ///< Adaptive recomputation distance
     Driver::UnsignedIntOption _node;          ///< Cutoff for number of nodes
@@ -350,6 +353,8 @@ namespace Gecode {
     Driver::UnsignedIntOption _r_scale;       ///< Restart scale factor
     Driver::BoolOption        _nogoods;       ///< Whether to use no-goods
     Driver::UnsignedIntOption _nogoods_limit; ///< Limit for no-good extraction
+    Driver::DoubleOption      _lns;           ///< Initial relaxation rate for LNS
+    Driver::DoubleOption      _lns_adapt;     ///< Adaptation factor for LNS
     Driver::BoolOption        _interrupt;     ///< Whether to catch SIGINT
     //@}
     
@@ -406,6 +411,10 @@ namespace Gecode {
     void decay(double d);
     /// Return decay factor
     double decay(void) const;
+    /// Set whether to schedule propagators according to AFC
+    void afc_schedule(bool b);
+    /// Return whether to schedule propagators according to AFC
+    bool afc_schedule(void) const;
     //@}
     
     /// \name Search options
@@ -426,6 +435,16 @@ namespace Gecode {
     void threads(double n);
     /// Return number of parallel threads
     double threads(void) const;
+
+    /// Set default work-stealing mode for parallel threads
+    void steal(Search::StealMode sm);
+    /// Return work-stealing mode for parallel threads
+    Search::StealMode steal(void) const;
+
+    /// Set default number of assets for portfolio-based search
+    void assets(unsigned int n);
+    /// Return number of assets for portfolio-based search
+    unsigned int assets(void) const;
     
     /// Set default copy recomputation distance
     void c_d(unsigned int d);
@@ -477,6 +496,16 @@ namespace Gecode {
     /// Return depth limit for nogoods
     unsigned int nogoods_limit(void) const;
     
+    /// Set default initial relaxation rate for LNS (0 means no LNS)
+    void lns(double r);
+    /// Return initial relaxation rate for LNS
+    double lns(void) const;
+    
+    /// Set default adaptation factor for LNS relaxation rate
+    void lns_adapt(double a);
+    /// Return adaptation factor for LNS relaxation rate
+    double lns_adapt(void) const;
+    
     /// Set default interrupt behavior
     void interrupt(bool b);
     /// Return interrupt behavior
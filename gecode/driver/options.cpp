@@ -365,11 +365,16 @@ namespace Gecode {
       _icl("-icl","integer consistency level",ICL_DEF),
       _branching("-branching","branching variants"),
       _decay("-decay","decay factor",1.0),
+      _afc_schedule("-afc-schedule",
+                    "whether to schedule propagators according to AFC",
+                    false),
       
       _search("-search","search engine variants"),
       _solutions("-solutions","number of solutions (0 = all)",1),
       _threads("-threads","number of threads (0 = #processing units)",
                Search::Config::threads),
+      _steal("-steal","how idle threads find work",Search::Config::steal),
+      _assets("-assets","number of portfolio assets (0 = no portfolio)",0),
       _c_d("-c-d","recomputation commit distance",Search::Config::c_d),
       _a_d("-a-d","recomputation adaptation distance",Search::Config::a_d),
       _node("-node","node cutoff (0 = none, solution mode)"),
@@ -381,6 +386,9 @@ namespace Gecode {
       _nogoods("-nogoods","whether to use no-goods from restarts",false),
       _nogoods_limit("-nogoods-limit","depth limit for no-good extraction",
                      Search::Config::nogoods_limit),
+      _lns("-lns","initial relaxation rate for LNS (0 = no LNS)",0.0),
+      _lns_adapt("-lns-adapt","adaptation factor for LNS relaxation rate",
+                 Search::Config::relax_adapt),
       _interrupt("-interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
       
@@ -404,6 +412,9 @@ namespace Gecode {
     _mode.add(SM_STAT, "stat");
     _mode.add(SM_GIST, "gist");
     
+    _steal.add(Search::SM_PATH,"path");
+    _steal.add(Search::SM_DEQUE,"deque");
+
     _restart.add(RM_NONE,"none");
     _restart.add(RM_CONSTANT,"constant");
     _restart.add(RM_LINEAR,"linear");
@@ -411,11 +422,14 @@ namespace Gecode {
     _restart.add(RM_GEOMETRIC,"geometric");
     
     add(_model); add(_symmetry); add(_propagation); add(_icl); 
-    add(_branching); add(_decay);
-    add(_search); add(_solutions); add(_threads); add(_c_d); add(_a_d);
+    add(_branching); add(_decay); add(_afc_schedule);
+    add(_search); add(_solutions); add(_threads); add(_steal);
+    add(_assets);
+    add(_c_d); add(_a_d);
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_restart); add(_r_base); add(_r_scale); 
     add(_nogoods); add(_nogoods_limit);
+    add(_lns); add(_lns_adapt);
     add(_mode); add(_iterations); add(_samples); add(_print_last);
     add(_out_file); add(_log_file);
   }
@@ -220,6 +220,15 @@ namespace Gecode {
   Options::decay(void) const {
     return _decay.value();
   }
+
+  inline void
+  Options::afc_schedule(bool b) {
+    _afc_schedule.value(b);
+  }
+  inline bool
+  Options::afc_schedule(void) const {
+    return _afc_schedule.value();
+  }
   
   
   /*
@@ -256,6 +265,24 @@ namespace Gecode {
   Options::threads(void) const {
     return _threads.value();
   }
+
+  inline void
+  Options::steal(Search::StealMode sm) {
+    _steal.value(sm);
+  }
+  inline Search::StealMode
+  Options::steal(void) const {
+    return static_cast<Search::StealMode>(_steal.value());
+  }
+
+  inline void
+  Options::assets(unsigned int n) {
+    _assets.value(n);
+  }
+  inline unsigned int
+  Options::assets(void) const {
+    return _assets.value();
+  }
   
   inline void
   Options::c_d(unsigned int d) {
@@ -347,6 +374,24 @@ namespace Gecode {
     return _nogoods_limit.value();
   }
   
+  inline void
+  Options::lns(double r) {
+    _lns.value(r);
+  }
+  inline double
+  Options::lns(void) const {
+    return _lns.value();
+  }
+  
+  inline void
+  Options::lns_adapt(double a) {
+    _lns_adapt.value(a);
+  }
+  inline double
+  Options::lns_adapt(void) const {
+    return _lns_adapt.value();
+  }
+  
   
   
   inline void
@@ -234,7 +234,11 @@ namespace Gecode { namespace Driver {
   template<class Script, template<class> class Engine, class Options>
   void
   ScriptBase<Space>::run(const Options& o, Script* s) {
-    if (o.restart()==RM_NONE) {
+    if (o.assets() > 0) {
+      runMeta<Script,Engine,Options,PBS>(o,s);
+    } else if (o.lns() > 0.0) {
+      runMeta<Script,Engine,Options,LNS>(o,s);
+    } else if (o.restart()==RM_NONE) {
       runMeta<Script,Engine,Options,EngineToMeta>(o,s);
     } else {
       runMeta<Script,Engine,Options,RBS>(o,s);
@@ -276,6 +280,8 @@ namespace Gecode { namespace Driver {
             opt.inspect.compare(o.inspect.compare(i));
           if (s == NULL)
             s = new Script(o);
+          if (o.afc_schedule())
+            s->afc_schedule(true);
           (void) GistEngine<Engine<Script> >::explore(s, opt);
         }
         break;
@@ -289,10 +295,16 @@ namespace Gecode { namespace Driver {
           t.start();
           if (s == NULL)
             s = new Script(o);
+          if (o.afc_schedule())
+            s->afc_schedule(true);
           unsigned int n_p = s->propagators();
           unsigned int n_b = s->branchers();
           Search::Options so;
           so.threads = o.threads();
+          so.steal   = o.steal();
+          so.assets  = o.assets();
+          so.relax   = o.lns();
+          so.relax_adapt = o.lns_adapt();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
           so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(), 
@@ -359,6 +371,7 @@ namespace Gecode { namespace Driver {
                   << "\tsolutions:    "
                   << ::abs(static_cast<int>(o.solutions()) - i) << endl
                   << "\tpropagations: " << stat.propagate << endl
+                  << "\tqueue ops:    " << stat.enqueue << endl
                   << "\tnodes:        " << stat.node << endl
                   << "\tfailures:     " << stat.fail << endl
                   << "\trestarts:     " << stat.restart << endl
@@ -382,11 +395,17 @@ namespace Gecode { namespace Driver {
           t.start();
           if (s == NULL)
             s = new Script(o);
+          if (o.afc_schedule())
+            s->afc_schedule(true);
           unsigned int n_p = s->propagators();
           unsigned int n_b = s->branchers();
           Search::Options so;
           so.clone   = false;
           so.threads = o.threads();
+          so.steal   = o.steal();
+          so.assets  = o.assets();
+          so.relax   = o.lns();
+          so.relax_adapt = o.lns_adapt();
           so.c_d     = o.c_d();
           so.a_d     = o.a_d();
           so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(),
@@ -415,6 +434,7 @@ namespace Gecode { namespace Driver {
                   << "\tsolutions:    "
                   << ::abs(static_cast<int>(o.solutions()) - i) << endl
                   << "\tpropagations: " << stat.propagate << endl
+                  << "\tqueue ops:    " << stat.enqueue << endl
                   << "\tnodes:        " << stat.node << endl
                   << "\tfailures:     " << stat.fail << endl
                   << "\trestarts:     " << stat.restart << endl
@@ -441,9 +461,15 @@ namespace Gecode { namespace Driver {
             for (unsigned int k = o.iterations(); !stopped && k--; ) {
               unsigned int i = o.solutions();
               Script* s = new Script(o);
+              if (o.afc_schedule())
+                s->afc_schedule(true);
               Search::Options so;
               so.clone   = false;
               so.threads = o.threads();
+              so.steal   = o.steal();
+              so.assets  = o.assets();
+              so.relax   = o.lns();
+              so.relax_adapt = o.lns_adapt();
               so.c_d     = o.c_d();
               so.a_d     = o.a_d();
               so.stop    = CombinedStop::create(o.node(),o.fail(), o.time(), 
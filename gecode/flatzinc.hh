@@ -209,6 +209,7 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::UnsignedIntOption _solutions; ///< How many solutions
       Gecode::Driver::BoolOption        _allSolutions; ///< Return all solutions
       Gecode::Driver::DoubleOption      _threads;   ///< How many threads to use
+      Gecode::Driver::UnsignedIntOption _assets;    ///< Number of portfolio assets
       Gecode::Driver::BoolOption        _free; ///< Use free search
       Gecode::Driver::DoubleOption      _decay;       ///< Decay option
       Gecode::Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
@@ -239,6 +240,7 @@ namespace Gecode { namespace FlatZinc {
       _allSolutions("-a", "return all solutions (equal to -solutions 0)"),
       _threads("-p","number of threads (0 = #processing units)",
                Gecode::Search::Config::threads),
+      _assets("-assets","number of portfolio assets (0 = no portfolio)",0),
       _free("--free", "no need to follow search-specification"),
       _decay("-decay","decay factor",0.99),
       _c_d("-c-d","recomputation commit distance",Gecode::Search::Config::c_d),
@@ -268,7 +270,7 @@ namespace Gecode { namespace FlatZinc {
       _restart.add(RM_LUBY,"luby");
       _restart.add(RM_GEOMETRIC,"geometric");
 
-      add(_solutions); add(_threads); add(_c_d); add(_a_d);
+      add(_solutions); add(_threads); add(_assets); add(_c_d); add(_a_d);
       add(_allSolutions);
       add(_free);
       add(_decay);
@@ -299,6 +301,7 @@ namespace Gecode { namespace FlatZinc {
     unsigned int solutions(void) const { return _solutions.value(); }
     bool allSolutions(void) const { return _allSolutions.value(); }
     double threads(void) const { return _threads.value(); }
+    unsigned int assets(void) const { return _assets.value(); }
     bool free(void) const { return _free.value(); }
     unsigned int c_d(void) const { return _c_d.value(); }
     unsigned int a_d(void) const { return _a_d.value(); }
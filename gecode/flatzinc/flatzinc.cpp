@@ -1405,7 +1405,9 @@ namespace Gecode { namespace FlatZinc {
   void
   FlatZincSpace::runEngine(std::ostream& out, const Printer& p,
                            const FlatZincOptions& opt, Support::Timer& t_total) {
-    if (opt.restart()==RM_NONE) {
+    if (opt.assets() > 0) {
+      runMeta<Engine,PBS>(out,p,opt,t_total);
+    } else if (opt.restart()==RM_NONE) {
       runMeta<Engine,Driver::EngineToMeta>(out,p,opt,t_total);
     } else {
       runMeta<Engine,RBS>(out,p,opt,t_total);
@@ -1438,6 +1440,7 @@ namespace Gecode { namespace FlatZinc {
     o.c_d = opt.c_d();
     o.a_d = opt.a_d();
     o.threads = opt.threads();
+    o.assets = opt.assets();
     o.nogoods_limit = opt.nogoods() ? opt.nogoods_limit() : 0;
     o.cutoff  = Driver::createCutoff(opt);
     if (opt.interrupt())
@@ -1489,6 +1492,7 @@ namespace Gecode { namespace FlatZinc {
            << (intVarCount + boolVarCount + setVarCount) << endl
            << "%%  propagators:   " << n_p << endl
            << "%%  propagations:  " << sstat.propagate+stat.propagate << endl
+           << "%%  queue ops:     " << sstat.enqueue+stat.enqueue << endl
            << "%%  nodes:         " << stat.node << endl
            << "%%  failures:      " << stat.fail << endl
            << "%%  restarts:      " << stat.restart << endl
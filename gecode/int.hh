@@ -1980,7 +1980,8 @@ namespace Gecode {
   enum ExtensionalPropKind {
     EPK_DEF,    ///< Make a default decision
     EPK_SPEED,  ///< Prefer speed over memory consumption
-    EPK_MEMORY  ///< Prefer little memory over speed
+    EPK_MEMORY, ///< Prefer little memory over speed
+    EPK_COMPACT ///< Use compact tables (bit-sets of valid tuples)
   };
 
   /**
@@ -2099,7 +2100,9 @@ namespace Gecode {
   /** \brief Post propagator for \f$x\in t\f$.
    *
    * \li Supports implementations optimized for memory (\a epk = \a
-   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED).
+   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED), as
+   *     well as compact tables (\a epk = \a EPK_COMPACT) which are
+   *     best suited for large tables.
    * \li Supports domain consistency (\a icl = ICL_DOM, default) only.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
@@ -2112,7 +2115,10 @@ namespace Gecode {
    * O\left(|x|\cdot\min_i(\underline{x_i})\cdot\max_i(\overline{x_i})\right)\f$
    * for the basic algorithm (\a epk = \a EPK_MEMORY) and additionally \f$
    * O\left(|x|^2\cdot\min_i(\underline{x_i})\cdot\max_i(\overline{x_i})\right)\f$
-   * for the incremental algorithm (\a epk = \a EPK_SPEED).
+   * for the incremental algorithm (\a epk = \a EPK_SPEED). For
+   * compact tables (\a epk = \a EPK_COMPACT), memory consumption is
+   * in \f$O(|x|\cdot|t|)\f$ for supports shared among all copies and
+   * \f$O(|t|)\f$ bits per copy.
    */
   GECODE_INT_EXPORT void
   extensional(Home home, const IntVarArgs& x, const TupleSet& t,
@@ -2121,7 +2127,9 @@ namespace Gecode {
   /** \brief Post propagator for \f$x\in t\f$.
    *
    * \li Supports implementations optimized for memory (\a epk = \a
-   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED).
+   *     EPK_MEMORY, default) and speed (\a epk = \a EPK_SPEED), as
+   *     well as compact tables (\a epk = \a EPK_COMPACT) which are
+   *     best suited for large tables.
    * \li Supports domain consistency (\a icl = ICL_DOM, default) only.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
@@ -2503,6 +2511,11 @@ namespace Gecode {
    * Propagate that no two rectangles as described by the coordinates
    * \a x, and \a y, widths \a w, and heights \a h overlap.
    * 
+   * Supports pairwise propagation (\a icl = ICL_DEF or ICL_VAL, default)
+   * and sweep-based propagation (\a icl = ICL_BND or ICL_DOM). The latter
+   * also prunes with the forbidden regions induced by the compulsory
+   * parts of several rectangles and scales better to many rectangles.
+   *
    * Throws the following exceptions:
    *  - Of type Int::ArgumentSizeMismatch if \a x, \a w, \a y, or \a h
    *    are not of the same size.
@@ -2521,6 +2534,10 @@ namespace Gecode {
    * \a x, and \a y, widths \a w, and heights \a h overlap. The rectangles
    * can be optional, as described by the Boolean variables \a o.
    * 
+   * Supports pairwise propagation (\a icl = ICL_DEF or ICL_VAL, default)
+   * and sweep-based propagation (\a icl = ICL_BND or ICL_DOM). The latter
+   * is only used if no rectangle is optional.
+   *
    * Throws the following exceptions:
    *  - Of type Int::ArgumentSizeMismatch if \a x, \a w, \a y, \a h, or \a o
    *    are not of the same size.
@@ -2544,6 +2561,11 @@ namespace Gecode {
    * not propagated (for \f$0\leq i<|x0|\f$). That is, additional constraints
    * must be posted to enforce that relation.
    *
+   * Supports pairwise propagation (\a icl = ICL_DEF or ICL_VAL, default)
+   * and sweep-based propagation (\a icl = ICL_BND or ICL_DOM). The latter
+   * also prunes with the forbidden regions induced by the compulsory
+   * parts of several rectangles and scales better to many rectangles.
+   *
    * Throws the following exceptions:
    *  - Of type Int::ArgumentSizeMismatch if \a x0, \a x1, \a w, 
    *    \a y0, \a y1, or \a h are not of the same size.
@@ -2566,6 +2588,10 @@ namespace Gecode {
    * not propagated (for \f$0\leq i<|x0|\f$). That is, additional constraints
    * must be posted to enforce that relation.
    *
+   * Supports pairwise propagation (\a icl = ICL_DEF or ICL_VAL, default)
+   * and sweep-based propagation (\a icl = ICL_BND or ICL_DOM). The latter
+   * is only used if no rectangle is optional.
+   *
    * Throws the following exceptions:
    *  - Of type Int::ArgumentSizeMismatch if \a x0, \a x1, \a w, 
    *    \a y0, \a y1, or \a h are not of the same size.
@@ -2738,6 +2764,8 @@ namespace Gecode {
    * 
    * The propagator performs overload checking, detectable precendence
    * propagation, not-first-not-last propagation, and edge finding.
+   * If \a icl is ICL_DOM, edge finding also takes optional tasks into
+   * account.
    *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    *    \a p, or \a m are of different size.
@@ -2806,6 +2834,8 @@ namespace Gecode {
    * 
    * The propagator performs overload checking, detectable precendence
    * propagation, not-first-not-last propagation, and edge finding.
+   * If \a icl is ICL_DOM, edge finding also takes optional tasks into
+   * account.
    *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    *    \a p, or \a m are of different size.
@@ -2858,6 +2888,8 @@ namespace Gecode {
    *
    * The propagator performs overload checking, detectable precendence
    * propagation, not-first-not-last propagation, and edge finding.
+   * If \a icl is ICL_DOM, edge finding also takes optional tasks into
+   * account.
    *
    * Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    * \a p, or \a m are of different size.
@@ -2894,6 +2926,9 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator also performs time-table
+   * edge-finding (taking quadratic time in the number of tasks).
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a t, \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -2945,6 +2980,9 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator also performs time-table
+   * edge-finding (taking quadratic time in the number of tasks).
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a t, \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -2982,6 +3020,9 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator also performs time-table
+   * edge-finding (taking quadratic time in the number of tasks).
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -3019,6 +3060,9 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator also performs time-table
+   * edge-finding (taking quadratic time in the number of tasks).
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    *    \a p, \a u, or \a m are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a p, \a u, or \a c
@@ -3058,6 +3102,9 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator also performs time-table
+   * edge-finding (taking quadratic time in the number of tasks).
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s 
    *    \a p, or \a u are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a u or \a c
@@ -3099,6 +3146,9 @@ namespace Gecode {
    * resources in O(kn log n). In I. P. Gent, editor, CP, volume 5732 of LNCS, 
    * pages 802-816. Springer, 2009.
    *
+   * If \a icl is ICL_DOM, the propagator also performs time-table
+   * edge-finding (taking quadratic time in the number of tasks).
+   *
    *  - Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
    *    \a p, \a u, or \a m are of different size.
    *  - Throws an exception of type Int::OutOfLimits, if \a u or \a c
@@ -3478,6 +3528,42 @@ namespace Gecode {
 
 }
 
+namespace Gecode {
+
+  /**
+   * \defgroup TaskModelIntRelax Relaxation for large neighbourhood search
+   * \ingroup TaskModelInt
+   *
+   * Relaxation fixes variables to their values in a solution and
+   * is intended to be used for implementing the relax function of
+   * a space used with large neighbourhood search (see LNS).
+   */
+  //@{
+  /**
+   * \brief Fix variables in \a x to their values in \a sx
+   *
+   * Each not yet assigned variable remains free with probability
+   * \a p, where random numbers are taken from \a r. If \a pg is true,
+   * relaxation is propagation-guided: variables are fixed one after
+   * the other with propagation in between, preferring variables
+   * whose domains have been reduced most by propagation.
+   *
+   * Returns whether some variable has been fixed.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a x
+   * and \a sx are of different size.
+   */
+  GECODE_INT_EXPORT bool
+  relax(Home home, const IntVarArgs& x, const IntVarArgs& sx, Rnd r,
+        double p, bool pg=false);
+  /// Fix variables in \a x to their values in \a sx
+  GECODE_INT_EXPORT bool
+  relax(Home home, const BoolVarArgs& x, const BoolVarArgs& sx, Rnd r,
+        double p, bool pg=false);
+  //@}
+
+}
+
 namespace Gecode {
 
   /**
@@ -95,14 +95,16 @@ namespace Gecode {
         for (int i=0; i<s.size(); i++)
           if (u[i] > 0)
             tasks[cur++].init(s[i],p[i],u[i]);
-        GECODE_ES_FAIL((ManProp<ManFixPTask,Cap>::post(home,c,tasks)));
+        GECODE_ES_FAIL((ManProp<ManFixPTask,Cap>::post(home,c,tasks,
+                                                       icl == ICL_DOM)));
       } else {
         TaskArray<ManFixPSETask> tasks(home,nonOptionals);
         int cur = 0;
         for (int i=s.size(); i--;)
           if (u[i] > 0)
             tasks[cur++].init(t[i],s[i],p[i],u[i]);
-        GECODE_ES_FAIL((ManProp<ManFixPSETask,Cap>::post(home,c,tasks)));
+        GECODE_ES_FAIL((ManProp<ManFixPSETask,Cap>::post(home,c,tasks,
+                                                         icl == ICL_DOM)));
       }
     }
   }
@@ -170,14 +172,16 @@ namespace Gecode {
         for (int i=0; i<s.size(); i++)
           if (u[i]>0)
             tasks[cur++].init(s[i],p[i],u[i],m[i]);
-        GECODE_ES_FAIL((OptProp<OptFixPTask,Cap>::post(home,c,tasks)));
+        GECODE_ES_FAIL((OptProp<OptFixPTask,Cap>::post(home,c,tasks,
+                                                       icl == ICL_DOM)));
       } else {
         TaskArray<OptFixPSETask> tasks(home,nonOptionals);
         int cur = 0;
         for (int i=s.size(); i--;)
           if (u[i]>0)
             tasks[cur++].init(t[i],s[i],p[i],u[i],m[i]);
-        GECODE_ES_FAIL((OptProp<OptFixPSETask,Cap>::post(home,c,tasks)));
+        GECODE_ES_FAIL((OptProp<OptFixPSETask,Cap>::post(home,c,tasks,
+                                                         icl == ICL_DOM)));
       }
     }
   }
@@ -243,7 +247,8 @@ namespace Gecode {
       for (int i=0; i<s.size(); i++)
         if (u[i]>0)
           t[cur++].init(s[i],p[i],u[i]);
-      GECODE_ES_FAIL((ManProp<ManFixPTask,Cap>::post(home,c,t)));
+      GECODE_ES_FAIL((ManProp<ManFixPTask,Cap>::post(home,c,t,
+                                                     icl == ICL_DOM)));
     }
   }
 
@@ -301,7 +306,8 @@ namespace Gecode {
       for (int i=0; i<s.size(); i++)
         if (u[i]>0)
           t[cur++].init(s[i],p[i],u[i],m[i]);
-      GECODE_ES_FAIL((OptProp<OptFixPTask,Cap>::post(home,c,t)));
+      GECODE_ES_FAIL((OptProp<OptFixPTask,Cap>::post(home,c,t,
+                                                     icl == ICL_DOM)));
     }
   }
 
@@ -365,7 +371,8 @@ namespace Gecode {
       for (int i=0; i<s.size(); i++)
         if (u[i]>0)
           t[cur++].init(s[i],p[i],e[i],u[i]);
-      GECODE_ES_FAIL((ManProp<ManFlexTask,Cap>::post(home,c,t)));
+      GECODE_ES_FAIL((ManProp<ManFlexTask,Cap>::post(home,c,t,
+                                                     icl == ICL_DOM)));
     }
   }
 
@@ -428,7 +435,8 @@ namespace Gecode {
       for (int i=s.size(); i--; )
         if (u[i]>0)
           t[cur++].init(s[i],p[i],e[i],u[i],m[i]);
-      GECODE_ES_FAIL((OptProp<OptFlexTask,Cap>::post(home,c,t)));
+      GECODE_ES_FAIL((OptProp<OptFlexTask,Cap>::post(home,c,t,
+                                                     icl == ICL_DOM)));
     }
   }
 
@@ -53,6 +53,12 @@
  *   Petr Vilm, Edge Finding Filtering Algorithm for Discrete
  *   Cumulative Resources in O(kn log n), CP, 2009.
  *
+ * Time-table edge-finding follows:
+ *   Andreas Schutt, Armin Wolf, A New O(n^2 log n) Not-First/Not-Last
+ *   Pruning Algorithm for Cumulative Resource Constraints, CP, 2010.
+ *   Petr Vilm, Timetable Edge Finding Filtering Algorithm for
+ *   Discrete Cumulative Resources, CP-AI-OR, 2011.
+ *
  * \brief %Scheduling for cumulative resources
  */
 
@@ -690,6 +696,87 @@ namespace Gecode { namespace Int { namespace Cumulative {
   template<class Task>
   ExecStatus edgefinding(Space& home, int c, TaskArray<Task>& t);
 
+  /// Propagate by time-table edge finding
+  template<class Task>
+  ExecStatus ttedgefinding(Space& home, int c, TaskArray<Task>& t);
+
+  class TTEvent;
+
+  /**
+   * \brief Resource profile made from the compulsory parts of tasks
+   *
+   * The profile consists of segments in increasing order of time, where
+   * segment \f$i\f$ covers the interval from its start up to (excluding)
+   * the start of segment \f$i+1\f$. Before the first and after the last
+   * segment the usage is zero. The profile is stored in space memory and
+   * is updated incrementally, as compulsory parts of tasks can only grow.
+   */
+  class Profile {
+  protected:
+    /// Start times of segments
+    int* tp;
+    /// Resource usage of segments
+    int* ru;
+    /// Number of segments
+    int n;
+    /// Number of allocated segments
+    int m;
+    /// Make sure that a segment starts at time \a t and return its index
+    int split(int t);
+    /// Merge neighboring segments with the same usage
+    void compact(void);
+  public:
+    /// Default constructor
+    Profile(void);
+    /// Initialize from events \a e of size \a k
+    void init(Space& home, TTEvent* e, int k);
+    /// Update profile to be a clone of profile \a p
+    void update(Space& home, const Profile& p);
+    /// Add usage \a c to the profile from time \a s to time \a e - 1
+    void add(Space& home, int s, int e, int c);
+    /// Return maximal usage
+    int max(void) const;
+    /// Return number of segments
+    int segments(void) const;
+    /// Return index of segment containing time \a t (-1 if before first segment)
+    int segment(int t) const;
+    /// Return start time of segment \a i
+    int start(int i) const;
+    /// Return end time of segment \a i
+    int end(int i) const;
+    /// Return usage of segment \a i
+    int usage(int i) const;
+    /// Release memory
+    void dispose(Space& home);
+  };
+
+  /**
+   * \brief %Advisor for a task of a cumulative propagator
+   *
+   * The advisor records the compulsory part of the task that is
+   * currently accounted for in the profile and whether the task has
+   * been modified since the profile was last brought up to date.
+   */
+  template<class ManTask>
+  class TaskAdvisor : public Advisor {
+  public:
+    /// The task
+    ManTask t;
+    /// Start of compulsory part accounted for in the profile
+    int lst;
+    /// End of compulsory part accounted for in the profile
+    int ect;
+    /// Whether the task has been modified
+    bool m;
+    /// Create advisor for task \a t0
+    TaskAdvisor(Space& home, Propagator& p, Council<TaskAdvisor<ManTask> >& c,
+                const ManTask& t0);
+    /// Constructor for cloning \a a
+    TaskAdvisor(Space& home, bool share, TaskAdvisor<ManTask>& a);
+    /// Dispose advisor
+    void dispose(Space& home, Council<TaskAdvisor<ManTask> >& c);
+  };
+
   /**
    * \brief Scheduling propagator for cumulative resource with mandatory tasks
    *
@@ -702,17 +789,39 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<ManTask,Int::PC_INT_DOM>::t;
     /// Resource capacity
     Cap c;
+    /// Whether to perform time-table edge finding
+    bool ttef;
+    /// Whether time-tabling is performed incrementally
+    bool inc;
+    /// Capacity when time-tabling was last performed
+    int tc;
+    /// Profile of compulsory parts for incremental time-tabling
+    Profile tt;
+    /// Advisors for tasks for incremental time-tabling
+    Council<TaskAdvisor<ManTask> > ta;
+    /// Perform incremental time-tabling
+    ExecStatus timetable(Space& home, bool& subsumed);
     /// Constructor for creation
-    ManProp(Home home, Cap c, TaskArray<ManTask>& t);
+    ManProp(Home home, Cap c, TaskArray<ManTask>& t, bool ttef);
     /// Constructor for cloning \a p
     ManProp(Space& home, bool shared, ManProp& p);
   public:
     /// Perform copying during cloning
     virtual Actor* copy(Space& home, bool share);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator that schedules tasks on cumulative resource
-    static ExecStatus post(Home home, Cap c, TaskArray<ManTask>& t);
+    /**
+     * \brief Post propagator that schedules tasks on cumulative resource
+     *
+     * If \a ttef is true, also time-table edge finding is performed.
+     * If all tasks have a positive minimal processing time, time-tabling
+     * maintains the profile of compulsory parts incrementally by
+     * advisors for the tasks.
+     */
+    static ExecStatus post(Home home, Cap c, TaskArray<ManTask>& t,
+                           bool ttef);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
@@ -729,8 +838,10 @@ namespace Gecode { namespace Int { namespace Cumulative {
     using TaskProp<OptTask,Int::PC_INT_DOM>::t;
     /// Resource capacity
     Cap c;
+    /// Whether to perform time-table edge finding
+    bool ttef;
     /// Constructor for creation
-    OptProp(Home home, Cap c, TaskArray<OptTask>& t);
+    OptProp(Home home, Cap c, TaskArray<OptTask>& t, bool ttef);
     /// Constructor for cloning \a p
     OptProp(Space& home, bool shared, OptProp& p);
   public:
@@ -738,8 +849,13 @@ namespace Gecode { namespace Int { namespace Cumulative {
     virtual Actor* copy(Space& home, bool share);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator that schedules tasks on cumulative resource
-    static ExecStatus post(Home home, Cap c, TaskArray<OptTask>& t);
+    /**
+     * \brief Post propagator that schedules tasks on cumulative resource
+     *
+     * If \a ttef is true, also time-table edge finding is performed.
+     */
+    static ExecStatus post(Home home, Cap c, TaskArray<OptTask>& t,
+                           bool ttef);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
@@ -749,6 +865,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
 #include <gecode/int/cumulative/basic.hpp>
 #include <gecode/int/cumulative/overload.hpp>
 #include <gecode/int/cumulative/edge-finding.hpp>
+#include <gecode/int/cumulative/tt-edge-finding.hpp>
+#include <gecode/int/cumulative/profile.hpp>
 #include <gecode/int/cumulative/man-prop.hpp>
 #include <gecode/int/cumulative/opt-prop.hpp>
 
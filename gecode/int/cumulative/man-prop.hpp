@@ -41,22 +41,48 @@ namespace Gecode { namespace Int { namespace Cumulative {
   
   template<class ManTask, class Cap>
   forceinline
-  ManProp<ManTask,Cap>::ManProp(Home home, Cap c0, TaskArray<ManTask>& t)
-    : TaskProp<ManTask,Int::PC_INT_DOM>(home,t), c(c0) {
+  ManProp<ManTask,Cap>::ManProp(Home home, Cap c0, TaskArray<ManTask>& t,
+                                bool ttef0)
+    : TaskProp<ManTask,Int::PC_INT_DOM>(home,t), c(c0), ttef(ttef0),
+      inc(true), tc(-1), ta(home) {
     c.subscribe(home,*this,Int::PC_INT_BND);
+    for (int i=t.size(); i--; )
+      if (t[i].pmin() == 0)
+        inc = false;
+    if (inc) {
+      // Initialize profile from compulsory parts
+      Region r(home);
+      TTEvent* e = r.alloc<TTEvent>(2*t.size());
+      int m = 0;
+      for (int i=t.size(); i--; )
+        if (t[i].lst() < t[i].ect()) {
+          e[m].t = t[i].lst(); e[m].c = t[i].c(); m++;
+          e[m].t = t[i].ect(); e[m].c = -t[i].c(); m++;
+        }
+      tt.init(home,e,m);
+      // Only tasks that are not yet assigned require advisors
+      for (int i=t.size(); i--; )
+        if (!t[i].assigned())
+          (void) new (home) TaskAdvisor<ManTask>(home,*this,ta,t[i]);
+    }
   }
 
   template<class ManTask, class Cap>
   forceinline
   ManProp<ManTask,Cap>::ManProp(Space& home, bool shared, 
                                 ManProp<ManTask,Cap>& p) 
-    : TaskProp<ManTask,Int::PC_INT_DOM>(home,shared,p) {
+    : TaskProp<ManTask,Int::PC_INT_DOM>(home,shared,p), ttef(p.ttef),
+      inc(p.inc), tc(p.tc) {
     c.update(home,shared,p.c);
+    ta.update(home,shared,p.ta);
+    if (inc)
+      tt.update(home,p.tt);
   }
 
   template<class ManTask, class Cap>
   forceinline ExecStatus 
-  ManProp<ManTask,Cap>::post(Home home, Cap c, TaskArray<ManTask>& t) {
+  ManProp<ManTask,Cap>::post(Home home, Cap c, TaskArray<ManTask>& t,
+                             bool ttef) {
     // Capacity must be nonnegative
     GECODE_ME_CHECK(c.gq(home, 0));
     // Check that tasks do not overload resource
@@ -73,7 +99,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
         return Unary::ManProp<typename TaskTraits<ManTask>::UnaryTask>
           ::post(home,mt);
       } else {
-        (void) new (home) ManProp<ManTask,Cap>(home,c,t);
+        (void) new (home) ManProp<ManTask,Cap>(home,c,t,ttef);
       }
     }
     return ES_OK;
@@ -90,9 +116,88 @@ namespace Gecode { namespace Int { namespace Cumulative {
   ManProp<ManTask,Cap>::dispose(Space& home) {
     (void) TaskProp<ManTask,Int::PC_INT_DOM>::dispose(home);
     c.cancel(home,*this,PC_INT_BND);
+    ta.dispose(home);
+    if (inc)
+      tt.dispose(home);
     return sizeof(*this);
   }
 
+  template<class ManTask, class Cap>
+  ExecStatus 
+  ManProp<ManTask,Cap>::advise(Space&, Advisor& a, const Delta&) {
+    // Only record the modification, the propagator is scheduled anyway
+    static_cast<TaskAdvisor<ManTask>&>(a).m = true;
+    return ES_FIX;
+  }
+
+  template<class ManTask, class Cap>
+  forceinline ExecStatus 
+  ManProp<ManTask,Cap>::timetable(Space& home, bool& subsumed) {
+    subsumed = false;
+    // Whether all tasks must be checked against the profile (as tc is
+    // initialized to -1, this is the case when propagating for the first time)
+    bool all = (c.max() != tc);
+    // Update profile with grown compulsory parts of modified tasks
+    for (Advisors<TaskAdvisor<ManTask> > as(ta); as(); ++as) {
+      TaskAdvisor<ManTask>& a = as.advisor();
+      if (a.m) {
+        int lst = a.t.lst(), ect = a.t.ect();
+        if ((lst < ect) && ((lst != a.lst) || (ect != a.ect))) {
+          if (a.lst < a.ect) {
+            tt.add(home,lst,a.lst,a.t.c());
+            tt.add(home,a.ect,ect,a.t.c());
+          } else {
+            tt.add(home,lst,ect,a.t.c());
+          }
+          a.lst = lst; a.ect = ect;
+          all = true;
+        }
+      }
+    }
+
+    int u = tt.max();
+    if (all) {
+      if (u > c.max())
+        return ES_FAILED;
+      GECODE_ME_CHECK(c.gq(home,u));
+    }
+    int cap = tc = c.max();
+
+    for (Advisors<TaskAdvisor<ManTask> > as(ta); as(); ++as) {
+      TaskAdvisor<ManTask>& a = as.advisor();
+      if (all || a.m) {
+        // Further modifications are recorded again by the advisor
+        a.m = false;
+        int ci = a.t.c();
+        if (u + ci > cap) {
+          if (ci > cap)
+            return ES_FAILED;
+          // Task cannot run in segments that have not enough capacity
+          for (int i = std::max(tt.segment(a.t.est()),0);
+               (i < tt.segments()) && (tt.start(i) < a.t.lct()); i++)
+            if (tt.usage(i) + ci > cap) {
+              // Exclude the task's own compulsory part
+              int s = tt.start(i), e = tt.end(i);
+              if (a.lst < a.ect) {
+                if (s < a.lst)
+                  GECODE_ME_CHECK(a.t.norun(home,s,std::min(e,a.lst)-1));
+                if (e > a.ect)
+                  GECODE_ME_CHECK(a.t.norun(home,std::max(s,a.ect),e-1));
+              } else {
+                GECODE_ME_CHECK(a.t.norun(home,s,e-1));
+              }
+            }
+        }
+      }
+      // Assigned tasks are completely accounted for in the profile
+      if (!a.m && a.t.assigned())
+        a.dispose(home,ta);
+    }
+
+    subsumed = ta.empty();
+    return ES_NOFIX;
+  }
+
   template<class ManTask, class Cap>
   ExecStatus 
   ManProp<ManTask,Cap>::propagate(Space& home, const ModEventDelta& med) {
@@ -100,8 +205,10 @@ namespace Gecode { namespace Int { namespace Cumulative {
     if (Int::IntView::me(med) != Int::ME_INT_DOM)
       GECODE_ES_CHECK(overload(home,c.max(),t));
     GECODE_ES_CHECK(edgefinding(home,c.max(),t));
+    if (ttef)
+      GECODE_ES_CHECK(ttedgefinding(home,c.max(),t));
     bool subsumed;
-    ExecStatus es = basic(home,subsumed,c,t);
+    ExecStatus es = inc ? timetable(home,subsumed) : basic(home,subsumed,c,t);
     GECODE_ES_CHECK(es);
     if (subsumed)
       return home.ES_SUBSUMED(*this);
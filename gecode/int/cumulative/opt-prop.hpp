@@ -43,8 +43,9 @@ namespace Gecode { namespace Int { namespace Cumulative {
   
   template<class OptTask, class Cap>
   forceinline
-  OptProp<OptTask,Cap>::OptProp(Home home, Cap c0, TaskArray<OptTask>& t)
-    : TaskProp<OptTask,Int::PC_INT_DOM>(home,t), c(c0) {
+  OptProp<OptTask,Cap>::OptProp(Home home, Cap c0, TaskArray<OptTask>& t,
+                                bool ttef0)
+    : TaskProp<OptTask,Int::PC_INT_DOM>(home,t), c(c0), ttef(ttef0) {
     c.subscribe(home,*this,PC_INT_BND);
   }
 
@@ -52,13 +53,14 @@ namespace Gecode { namespace Int { namespace Cumulative {
   forceinline
   OptProp<OptTask,Cap>::OptProp(Space& home, bool shared,
                                 OptProp<OptTask,Cap>& p) 
-    : TaskProp<OptTask,Int::PC_INT_DOM>(home,shared,p) {
+    : TaskProp<OptTask,Int::PC_INT_DOM>(home,shared,p), ttef(p.ttef) {
     c.update(home,shared,p.c);
   }
 
   template<class OptTask, class Cap>
   forceinline ExecStatus 
-  OptProp<OptTask,Cap>::post(Home home, Cap c, TaskArray<OptTask>& t) {
+  OptProp<OptTask,Cap>::post(Home home, Cap c, TaskArray<OptTask>& t,
+                             bool ttef) {
     // Capacity must be nonnegative
     GECODE_ME_CHECK(c.gq(home, 0));
     // Check for overload by single task and remove excluded tasks
@@ -89,16 +91,16 @@ namespace Gecode { namespace Int { namespace Cumulative {
       for (int i=t.size(); i--; )
         mt[i]=t[i];
       return Unary::OptProp<typename TaskTraits<OptTask>::UnaryTask>
-        ::post(home,mt);
+        ::post(home,mt,ttef);
     }
     if (m == t.size()) {
       TaskArray<typename TaskTraits<OptTask>::ManTask> mt(home,m);
       for (int i=m; i--; )
         mt[i].init(t[i]);
       return ManProp<typename TaskTraits<OptTask>::ManTask,Cap>
-        ::post(home,c,mt);
+        ::post(home,c,mt,ttef);
     }
-    (void) new (home) OptProp<OptTask,Cap>(home,c,t);
+    (void) new (home) OptProp<OptTask,Cap>(home,c,t,ttef);
     return ES_OK;
   }
 
@@ -145,6 +147,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
       // Truncate array to only contain mandatory tasks
       t.size(i);
       GECODE_ES_CHECK(edgefinding(home,c.max(),t));
+      if (ttef)
+        GECODE_ES_CHECK(ttedgefinding(home,c.max(),t));
       // Restore to also include optional tasks
       t.size(n);
     }
@@ -160,7 +164,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
         ut[i]=t[i];
       GECODE_REWRITE(*this,
         (Unary::OptProp<typename TaskTraits<OptTask>::UnaryTask>
-          ::post(home(*this),ut)));
+          ::post(home(*this),ut,ttef)));
     } else {
       return ES_NOFIX;
     }
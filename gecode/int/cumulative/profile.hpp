@@ -0,0 +1,207 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /*
+   * Profile
+   *
+   */
+
+  forceinline
+  Profile::Profile(void) 
+    : tp(NULL), ru(NULL), n(0), m(0) {}
+
+  forceinline void
+  Profile::init(Space& home, TTEvent* e, int k) {
+    Support::quicksort(e, k);
+    m = k+2;
+    tp = home.alloc<int>(m); ru = home.alloc<int>(m);
+    n = 0;
+    int u = 0;
+    for (int i=0; i<k; i++) {
+      u += e[i].c;
+      if ((n > 0) && (tp[n-1] == e[i].t)) {
+        ru[n-1] = u;
+      } else {
+        tp[n] = e[i].t; ru[n] = u; n++;
+      }
+    }
+    compact();
+  }
+
+  forceinline void
+  Profile::update(Space& home, const Profile& p) {
+    n = p.n; m = p.n+2;
+    tp = home.alloc<int>(m); ru = home.alloc<int>(m);
+    for (int i=n; i--; ) {
+      tp[i] = p.tp[i]; ru[i] = p.ru[i];
+    }
+  }
+
+  forceinline void
+  Profile::compact(void) {
+    int j = 0;
+    for (int i=0; i<n; i++)
+      if (ru[i] != ((j > 0) ? ru[j-1] : 0)) {
+        tp[j] = tp[i]; ru[j] = ru[i]; j++;
+      }
+    n = j;
+  }
+
+  forceinline int
+  Profile::split(int t) {
+    // Find first segment not starting before t
+    int l = 0, h = n;
+    while (l < h) {
+      int k = l + (h-l) / 2;
+      if (tp[k] < t)
+        l = k+1;
+      else
+        h = k;
+    }
+    if ((l < n) && (tp[l] == t))
+      return l;
+    assert(n < m);
+    for (int i=n; i>l; i--) {
+      tp[i] = tp[i-1]; ru[i] = ru[i-1];
+    }
+    tp[l] = t; ru[l] = (l > 0) ? ru[l-1] : 0;
+    n++;
+    return l;
+  }
+
+  forceinline void
+  Profile::add(Space& home, int s, int e, int c) {
+    if ((s >= e) || (c == 0))
+      return;
+    if (n+2 > m) {
+      compact();
+      if (n+2 > m) {
+        int k = 2*m;
+        tp = home.realloc<int>(tp, m, k); ru = home.realloc<int>(ru, m, k);
+        m = k;
+      }
+    }
+    int i = split(s);
+    int j = split(e);
+    for ( ; i<j; i++)
+      ru[i] += c;
+  }
+
+  forceinline int
+  Profile::max(void) const {
+    int u = 0;
+    for (int i=n; i--; )
+      u = std::max(u, ru[i]);
+    return u;
+  }
+
+  forceinline int
+  Profile::segments(void) const {
+    return n;
+  }
+
+  forceinline int
+  Profile::segment(int t) const {
+    // Find last segment not starting after t
+    int l = 0, h = n;
+    while (l < h) {
+      int k = l + (h-l) / 2;
+      if (tp[k] <= t)
+        l = k+1;
+      else
+        h = k;
+    }
+    return l-1;
+  }
+
+  forceinline int
+  Profile::start(int i) const {
+    return tp[i];
+  }
+
+  forceinline int
+  Profile::end(int i) const {
+    return (i+1 < n) ? tp[i+1] : Int::Limits::infinity;
+  }
+
+  forceinline int
+  Profile::usage(int i) const {
+    return ru[i];
+  }
+
+  forceinline void
+  Profile::dispose(Space& home) {
+    home.free<int>(tp, m); home.free<int>(ru, m);
+  }
+
+
+  /*
+   * Advisor for tasks
+   *
+   */
+
+  template<class ManTask>
+  forceinline
+  TaskAdvisor<ManTask>::TaskAdvisor(Space& home, Propagator& p,
+                                    Council<TaskAdvisor<ManTask> >& c,
+                                    const ManTask& t0)
+    : Advisor(home,p,c), t(t0), lst(t0.lst()), ect(t0.ect()), m(true) {
+    t.subscribe(home,*this);
+  }
+
+  template<class ManTask>
+  forceinline
+  TaskAdvisor<ManTask>::TaskAdvisor(Space& home, bool share,
+                                    TaskAdvisor<ManTask>& a)
+    : Advisor(home,share,a), lst(a.lst), ect(a.ect), m(a.m) {
+    t.update(home,share,a.t);
+  }
+
+  template<class ManTask>
+  forceinline void
+  TaskAdvisor<ManTask>::dispose(Space& home,
+                                Council<TaskAdvisor<ManTask> >& c) {
+    t.cancel(home,*this);
+    Advisor::dispose(home,c);
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -0,0 +1,218 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  /// Event for time-table: capacity changes by \a c at time \a t
+  class TTEvent {
+  public:
+    /// Time of event
+    int t;
+    /// Change in required capacity
+    int c;
+    /// Order by time
+    bool operator <(const TTEvent& e) const;
+  };
+
+  /// Time-table made from the compulsory parts of tasks
+  class TimeTable {
+  protected:
+    /// Number of time points
+    int n;
+    /// Time points in increasing order
+    int* tp;
+    /// Energy of compulsory parts before a time point
+    long long int* en;
+    /// Required capacity from a time point on
+    long long int* rc;
+  public:
+    /// Initialize from events \a e of size \a m
+    TimeTable(Region& r, TTEvent* e, int m);
+    /// Return energy of compulsory parts before time \a t
+    long long int energy(int t) const;
+  };
+
+
+  forceinline bool
+  TTEvent::operator <(const TTEvent& e) const {
+    return t < e.t;
+  }
+
+  forceinline
+  TimeTable::TimeTable(Region& r, TTEvent* e, int m)
+    : n(0), tp(r.alloc<int>(m)), 
+      en(r.alloc<long long int>(m)), rc(r.alloc<long long int>(m)) {
+    Support::quicksort(e, m);
+    long long int ce = 0, cc = 0;
+    for (int i=0; i<m; i++) {
+      if ((n > 0) && (tp[n-1] == e[i].t)) {
+        cc += e[i].c; rc[n-1] = cc;
+      } else {
+        if (n > 0)
+          ce += rc[n-1] * (static_cast<long long int>(e[i].t) - tp[n-1]);
+        cc += e[i].c;
+        tp[n] = e[i].t; en[n] = ce; rc[n] = cc; n++;
+      }
+    }
+  }
+
+  forceinline long long int
+  TimeTable::energy(int t) const {
+    // Find last time point not after t
+    int l = 0, h = n;
+    while (l < h) {
+      int m = l + (h-l) / 2;
+      if (tp[m] <= t)
+        l = m+1;
+      else
+        h = m;
+    }
+    if (l == 0)
+      return 0;
+    l--;
+    return en[l] + rc[l] * (static_cast<long long int>(t) - tp[l]);
+  }
+
+
+  template<class TaskView>
+  forceinline ExecStatus
+  ttedgefinding(Space& home, int c, TaskViewArray<TaskView>& t) {
+    int n = t.size();
+    sort<TaskView,STO_LCT,true>(t);
+
+    Region r(home);
+
+    // Compute time-table from compulsory parts
+    TTEvent* e = r.alloc<TTEvent>(2*n);
+    int m = 0;
+    for (int i=n; i--; )
+      if ((t[i].lst() < t[i].ect()) && (t[i].c() > 0)) {
+        e[m].t = t[i].lst(); e[m].c = t[i].c(); m++;
+        e[m].t = t[i].ect(); e[m].c = -t[i].c(); m++;
+      }
+    TimeTable tt(r,e,m);
+
+    // Energy of the free parts of the tasks and time-table energy at est
+    long long int* fe = r.alloc<long long int>(n);
+    long long int* te = r.alloc<long long int>(n);
+    for (int i=n; i--; ) {
+      int cp = std::max(0, t[i].ect() - t[i].lst());
+      fe[i] = static_cast<long long int>(t[i].c()) * 
+        std::max(0, t[i].pmin() - cp);
+      te[i] = tt.energy(t[i].est());
+    }
+
+    // Tasks by decreasing earliest start time
+    int* est = r.alloc<int>(n);
+    sort<TaskView,STO_EST,false>(est, t);
+
+    // Updated earliest start times
+    int* u = r.alloc<int>(n);
+    for (int i=n; i--; )
+      u[i] = t[i].est();
+
+    // Consider all windows [a,b) with a an earliest start time
+    // and b a latest completion time
+    for (int j=n; j--; ) {
+      // Only consider the window once for all tasks with same lct
+      if ((j+1 < n) && (t[j+1].lct() == t[j].lct()))
+        continue;
+      int b = t[j].lct();
+      long long int tb = tt.energy(b);
+      // Energy of free parts of tasks inside the window
+      long long int fin = 0;
+      // Task (not inside) requiring most energy in the window
+      int v = -1; long long int ev = 0; 
+      for (int k=0; k<n; k++) {
+        int i = est[k];
+        int a = t[i].est();
+        if (a >= b)
+          continue;
+        if (t[i].lct() <= b) {
+          fin += fe[i];
+        } else if (t[i].c() > 0) {
+          // Energy of task when starting at a, excluding its compulsory part
+          int eb = std::min(t[i].ect(),b);
+          long long int ei = static_cast<long long int>(t[i].c()) * 
+            (eb - a - std::max(0, eb - t[i].lst()));
+          if (ei > ev) {
+            v = i; ev = ei;
+          }
+        }
+        // Only consider the window once for all tasks with same est
+        if ((k+1 < n) && (t[est[k+1]].est() == a))
+          continue;
+        long long int avail = 
+          static_cast<long long int>(c) * (static_cast<long long int>(b)-a)
+          - fin - (tb - te[i]);
+        if (avail < 0)
+          return ES_FAILED;
+        if (ev > avail) {
+          // Task v must not use more than its share of available energy
+          int eb = std::min(t[v].ect(),b);
+          long long int l = avail / t[v].c() + 
+            std::max(0, eb - t[v].lst());
+          long long int s = ((t[v].pmin() > l) ? b : eb) - l;
+          if (s > u[v])
+            u[v] = static_cast<int>(s);
+        }
+      }
+    }
+
+    for (int i=n; i--; )
+      if (u[i] > t[i].est())
+        GECODE_ME_CHECK(t[i].est(home,u[i]));
+
+    return ES_OK;
+  }
+
+  template<class Task>
+  ExecStatus
+  ttedgefinding(Space& home, int c, TaskArray<Task>& t) {
+    TaskViewArray<typename TaskTraits<Task>::TaskViewFwd> f(t);
+    GECODE_ES_CHECK(ttedgefinding(home,c,f));
+    TaskViewArray<typename TaskTraits<Task>::TaskViewBwd> b(t);
+    GECODE_ES_CHECK(ttedgefinding(home,c,b));
+    return ES_OK;
+  }
+    
+}}}
+
+// STATISTICS: int-prop
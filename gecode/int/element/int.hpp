@@ -164,6 +164,8 @@ namespace Gecode { namespace Int { namespace Element {
     home.notice(*this,AP_DISPOSE);
     x0.subscribe(home,*this,PC_INT_DOM);
     x1.subscribe(home,*this,PC_INT_DOM);
+    // The array is not modified, hence clones can refer to it
+    c.freeze(home);
   }
 
   template<class V0, class V1, class Idx, class Val>
@@ -85,6 +85,15 @@ namespace Gecode {
       GECODE_ES_FAIL((Extensional::Incremental<IntView>
                            ::post(home,xv,t)));
       break;
+    case EPK_COMPACT:
+      if (x.same(home)) {
+        GECODE_ES_FAIL((Extensional::Basic<IntView,true>
+                             ::post(home,xv,t)));
+      } else {
+        GECODE_ES_FAIL((Extensional::Compact<IntView>
+                             ::post(home,xv,t)));
+      }
+      break;
     default:
       if (x.same(home)) {
         GECODE_ES_FAIL((Extensional::Basic<IntView,true>
@@ -122,6 +131,15 @@ namespace Gecode {
       GECODE_ES_FAIL((Extensional::Incremental<BoolView>
                            ::post(home,xv,t)));
       break;
+    case EPK_COMPACT:
+      if (x.same(home)) {
+        GECODE_ES_FAIL((Extensional::Basic<BoolView,true>
+                             ::post(home,xv,t)));
+      } else {
+        GECODE_ES_FAIL((Extensional::Compact<BoolView>
+                             ::post(home,xv,t)));
+      }
+      break;
     default:
       if (x.same(home)) {
         GECODE_ES_FAIL((Extensional::Basic<BoolView,true>
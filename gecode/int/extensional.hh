@@ -502,6 +502,160 @@ namespace Gecode { namespace Int { namespace Extensional {
 #include <gecode/int/extensional/incremental.hpp>
 
 
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /**
+   * \brief Domain consistent compact-table extensional propagator
+   *
+   * This propagator implements the compact-table algorithm from:
+   *   Jordan Demeulenaere, Renaud Hartert, Christophe Lecoutre,
+   *   Guillaume Perez, Laurent Perron, Jean-Charles R\'egin, and
+   *   Pierre Schaus, Compact-Table: Efficiently Filtering Table
+   *   Constraints with Reversible Sparse Bit-Sets, CP 2016.
+   *
+   * The tuples that are valid with respect to the current domains
+   * are kept as a sparse bit-set: only the indices of words with at
+   * least one bit set are considered. For each view and value, the
+   * non-zero words of the bit-set of tuples supporting the value are
+   * computed when the propagator is posted and are shared among all
+   * copies. Advisors update the valid tuples incrementally (or by
+   * recomputation if fewer values remain than have been removed)
+   * and propagation only checks whether values still have support,
+   * starting from the word where support has been found last.
+   *
+   * The propagator is not capable of dealing with multiple occurences
+   * of the same view.
+   *
+   * Requires \code #include <gecode/int/extensional.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class View>
+  class Compact : public Propagator {
+  protected:
+    /// Type of bit-set words
+    typedef unsigned long long int Word;
+    /// Number of bits per word
+    static const unsigned int bpw =
+      static_cast<unsigned int>(CHAR_BIT * sizeof(Word));
+    /// %Support information shared among all copies
+    class Supports : public SharedHandle {
+    protected:
+      /// The actual support information
+      class SupportsI : public SharedHandle::Object {
+      public:
+        /// Number of valid tuples
+        int n_tuples;
+        /// Number of words for valid tuples
+        int n_words;
+        /// Number of views
+        int n_views;
+        /// Number of view-value pairs
+        int n_vals;
+        /// Number of support entries
+        int n_entries;
+        /// Smallest value per view
+        int* vmin;
+        /// Offset of view-value pairs per view
+        int* voff;
+        /// First support entry per view-value pair (plus end)
+        int* fst;
+        /// Support entry where support has been found last
+        int* res;
+        /// Word index per support entry
+        int* widx;
+        /// Word per support entry
+        Word* bits;
+        /// Initialize as empty
+        SupportsI(void);
+        /// Allocate memory
+        void allocate(void);
+        /// Create a copy
+        virtual SharedHandle::Object* copy(void) const;
+        /// Delete support information
+        virtual ~SupportsI(void);
+      };
+      /// Return support information
+      SupportsI* supports(void) const;
+    public:
+      /// Initialize as empty
+      Supports(void);
+      /// Initialize for views \a x and tuple set \a t
+      Supports(Space& home, const ViewArray<View>& x, const TupleSet& t);
+      /// Return number of words for valid tuples
+      int words(void) const;
+      /// Initialize valid tuples \a w
+      void init(Word* w) const;
+      /// Return index of view-value pair for view \a i and value \a n
+      int pair(int i, int n) const;
+      /// Return first support entry for pair \a p
+      int fst(int p) const;
+      /// Return last support entry (exclusive) for pair \a p
+      int lst(int p) const;
+      /// Return word index of support entry \a e
+      int widx(int e) const;
+      /// Return word of support entry \a e
+      Word bits(int e) const;
+      /// Return support entry where support has been found last for \a p
+      int res(int p) const;
+      /// Set support entry \a e where support has been found for \a p
+      void res(int p, int e) const;
+    };
+    /// %Advisors for views (by position in array)
+    class CTAdvisor : public Advisor {
+    public:
+      /// The position of the view in the view array
+      int i;
+      /// Create advisor for view at position \a i
+      CTAdvisor(Space& home, Propagator& p, Council<CTAdvisor>& c, int i);
+      /// Clone advisor \a a
+      CTAdvisor(Space& home, bool share, CTAdvisor& a);
+    };
+    /// The advisor council
+    Council<CTAdvisor> c;
+    /// The views
+    ViewArray<View> x;
+    /// %Support information
+    Supports s;
+    /// Words of valid tuples
+    Word* words;
+    /// Indices of non-zero words
+    int* index;
+    /// Number of non-zero words
+    int limit;
+    /// View modified since last propagation (-1 none, -2 several)
+    int touched;
+    /// Remove tuples for values between \a l and \a u of view \a i
+    bool remove(int i, int l, int u);
+    /// Keep only tuples for values of view \a i
+    bool reset(Space& home, int i);
+    /// Remove all zero words from index
+    void compress(void);
+    /// Test whether value \a n of view \a i has support
+    bool supported(int i, int n);
+    /// Constructor for cloning \a p
+    Compact(Space& home, bool share, Compact<View>& p);
+    /// Constructor for posting
+    Compact(Home home, ViewArray<View>& x, const Supports& s);
+  public:
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Cost function (defined as low quadratic)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post propagator for views \a x
+    static ExecStatus post(Home home, ViewArray<View>& x, const TupleSet& t);
+  };
+
+}}}
+
+#include <gecode/int/extensional/compact.hpp>
+
+
 #endif
 
 // STATISTICS: int-prop
@@ -54,6 +54,9 @@ namespace Gecode { namespace Int { namespace Extensional {
 
     assert(ts()->finalized());
 
+    // The tuple set is not modified, hence clones can refer to it
+    tupleSet.freeze(home);
+
     init_last(home, ts()->last, ts()->tuple_data);
 
     home.notice(*this,AP_DISPOSE);
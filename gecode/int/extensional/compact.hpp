@@ -0,0 +1,436 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /*
+   * Support information
+   *
+   */
+  template<class View>
+  forceinline
+  Compact<View>::Supports::SupportsI::SupportsI(void)
+    : n_tuples(0), n_words(0), n_views(0), n_vals(0), n_entries(0),
+      vmin(NULL), voff(NULL), fst(NULL), res(NULL),
+      widx(NULL), bits(NULL) {}
+
+  template<class View>
+  forceinline void
+  Compact<View>::Supports::SupportsI::allocate(void) {
+    vmin = heap.alloc<int>(n_views);
+    voff = heap.alloc<int>(n_views);
+    fst  = heap.alloc<int>(n_vals+1);
+    res  = heap.alloc<int>(n_vals);
+    widx = heap.alloc<int>(n_entries);
+    bits = heap.alloc<Word>(n_entries);
+  }
+
+  template<class View>
+  SharedHandle::Object*
+  Compact<View>::Supports::SupportsI::copy(void) const {
+    SupportsI* s = new SupportsI;
+    s->n_tuples = n_tuples; s->n_words = n_words; s->n_views = n_views;
+    s->n_vals = n_vals; s->n_entries = n_entries;
+    s->allocate();
+    Heap::copy(s->vmin,vmin,n_views);
+    Heap::copy(s->voff,voff,n_views);
+    Heap::copy(s->fst,fst,n_vals+1);
+    Heap::copy(s->res,res,n_vals);
+    Heap::copy(s->widx,widx,n_entries);
+    Heap::copy(s->bits,bits,n_entries);
+    return s;
+  }
+
+  template<class View>
+  Compact<View>::Supports::SupportsI::~SupportsI(void) {
+    heap.free<int>(vmin,n_views);
+    heap.free<int>(voff,n_views);
+    heap.free<int>(fst,n_vals+1);
+    heap.free<int>(res,n_vals);
+    heap.free<int>(widx,n_entries);
+    heap.free<Word>(bits,n_entries);
+  }
+
+  template<class View>
+  forceinline typename Compact<View>::Supports::SupportsI*
+  Compact<View>::Supports::supports(void) const {
+    return static_cast<SupportsI*>(object());
+  }
+
+  template<class View>
+  forceinline
+  Compact<View>::Supports::Supports(void) {}
+
+  template<class View>
+  Compact<View>::Supports::Supports(Space& home, const ViewArray<View>& x,
+                                    const TupleSet& t)
+    : SharedHandle(new SupportsI) {
+    SupportsI& si = *supports();
+    Region r(home);
+    int n = x.size();
+
+    // Only tuples that are valid for the current domains are considered
+    int* valid = r.alloc<int>(t.tuples());
+    int n_valid = 0;
+    for (int k=0; k<t.tuples(); k++) {
+      TupleSet::Tuple tk = t[k];
+      int i = 0;
+      while ((i < n) && x[i].in(tk[i]))
+        i++;
+      if (i == n)
+        valid[n_valid++] = k;
+    }
+
+    si.n_tuples = n_valid;
+    si.n_words = static_cast<int>((n_valid + bpw - 1) / bpw);
+    si.n_views = n;
+    int* vmin = r.alloc<int>(n);
+    int* voff = r.alloc<int>(n);
+    si.n_vals = 0;
+    for (int i=0; i<n; i++) {
+      vmin[i] = x[i].min(); voff[i] = si.n_vals;
+      si.n_vals += x[i].max() - x[i].min() + 1;
+    }
+
+    // Count the words per view-value pair
+    int* last = r.alloc<int>(si.n_vals);
+    int* cnt = r.alloc<int>(si.n_vals+1);
+    for (int p=si.n_vals; p--; ) {
+      last[p] = -1; cnt[p] = 0;
+    }
+    for (int j=0; j<n_valid; j++) {
+      TupleSet::Tuple tj = t[valid[j]];
+      int w = static_cast<int>(j / bpw);
+      for (int i=0; i<n; i++) {
+        int p = voff[i] + tj[i] - vmin[i];
+        if (last[p] != w) {
+          last[p] = w; cnt[p]++;
+        }
+      }
+    }
+    si.n_entries = 0;
+    for (int p=0; p<si.n_vals; p++) {
+      int c = cnt[p]; cnt[p] = si.n_entries; si.n_entries += c;
+    }
+    cnt[si.n_vals] = si.n_entries;
+
+    si.allocate();
+    Heap::copy(si.vmin,vmin,n);
+    Heap::copy(si.voff,voff,n);
+    Heap::copy(si.fst,cnt,si.n_vals+1);
+    Heap::copy(si.res,cnt,si.n_vals);
+
+    // Fill in the words, cnt now gives the next free entry
+    for (int p=si.n_vals; p--; )
+      last[p] = -1;
+    for (int j=0; j<n_valid; j++) {
+      TupleSet::Tuple tj = t[valid[j]];
+      int w = static_cast<int>(j / bpw);
+      Word b = static_cast<Word>(1) << (j % bpw);
+      for (int i=0; i<n; i++) {
+        int p = voff[i] + tj[i] - vmin[i];
+        if (last[p] != w) {
+          last[p] = w;
+          si.widx[cnt[p]] = w; si.bits[cnt[p]] = 0; cnt[p]++;
+        }
+        si.bits[cnt[p]-1] |= b;
+      }
+    }
+  }
+
+  template<class View>
+  forceinline int
+  Compact<View>::Supports::words(void) const {
+    return supports()->n_words;
+  }
+  template<class View>
+  forceinline void
+  Compact<View>::Supports::init(Word* w) const {
+    int n = supports()->n_tuples;
+    for (int i=supports()->n_words; i--; )
+      w[i] = ~static_cast<Word>(0);
+    if ((n % bpw) != 0)
+      w[n / bpw] = (static_cast<Word>(1) << (n % bpw)) - 1;
+  }
+  template<class View>
+  forceinline int
+  Compact<View>::Supports::pair(int i, int n) const {
+    return supports()->voff[i] + n - supports()->vmin[i];
+  }
+  template<class View>
+  forceinline int
+  Compact<View>::Supports::fst(int p) const {
+    return supports()->fst[p];
+  }
+  template<class View>
+  forceinline int
+  Compact<View>::Supports::lst(int p) const {
+    return supports()->fst[p+1];
+  }
+  template<class View>
+  forceinline int
+  Compact<View>::Supports::widx(int e) const {
+    return supports()->widx[e];
+  }
+  template<class View>
+  forceinline typename Compact<View>::Word
+  Compact<View>::Supports::bits(int e) const {
+    return supports()->bits[e];
+  }
+  template<class View>
+  forceinline int
+  Compact<View>::Supports::res(int p) const {
+    return supports()->res[p];
+  }
+  template<class View>
+  forceinline void
+  Compact<View>::Supports::res(int p, int e) const {
+    supports()->res[p] = e;
+  }
+
+
+  /*
+   * Advisor
+   *
+   */
+  template<class View>
+  forceinline
+  Compact<View>::CTAdvisor::CTAdvisor(Space& home, Propagator& p,
+                                      Council<CTAdvisor>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+
+  template<class View>
+  forceinline
+  Compact<View>::CTAdvisor::CTAdvisor(Space& home, bool share, CTAdvisor& a)
+    : Advisor(home,share,a), i(a.i) {}
+
+
+  /*
+   * The propagator proper
+   *
+   */
+  template<class View>
+  forceinline
+  Compact<View>::Compact(Home home, ViewArray<View>& x0, const Supports& s0)
+    : Propagator(home), c(home), x(x0), s(s0), touched(-2) {
+    int n = s.words();
+    words = static_cast<Space&>(home).alloc<Word>(n);
+    index = static_cast<Space&>(home).alloc<int>(n);
+    s.init(words);
+    for (int i=0; i<n; i++)
+      index[i] = i;
+    limit = n;
+    for (int i=x.size(); i--; )
+      if (!x[i].assigned())
+        x[i].subscribe(home, *new (home) CTAdvisor(home,*this,c,i));
+    // Boolean views only accept the assignment event for scheduling
+    View::schedule(home,*this,ME_GEN_ASSIGNED);
+  }
+
+  template<class View>
+  forceinline
+  Compact<View>::Compact(Space& home, bool share, Compact<View>& p)
+    : Propagator(home,share,p), touched(p.touched) {
+    c.update(home,share,p.c);
+    x.update(home,share,p.x);
+    s.update(home,share,p.s);
+    int n = s.words();
+    words = home.alloc<Word>(n);
+    for (int i=n; i--; )
+      words[i] = 0;
+    limit = p.limit;
+    index = home.alloc<int>(n);
+    for (int k=limit; k--; ) {
+      index[k] = p.index[k]; words[index[k]] = p.words[index[k]];
+    }
+  }
+
+  template<class View>
+  Actor*
+  Compact<View>::copy(Space& home, bool share) {
+    return new (home) Compact<View>(home,share,*this);
+  }
+
+  template<class View>
+  PropCost
+  Compact<View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::quadratic(PropCost::LO,x.size());
+  }
+
+  template<class View>
+  forceinline void
+  Compact<View>::compress(void) {
+    int k = 0;
+    while (k < limit)
+      if (words[index[k]] == 0)
+        index[k] = index[--limit];
+      else
+        k++;
+  }
+
+  template<class View>
+  forceinline bool
+  Compact<View>::remove(int i, int l, int u) {
+    bool changed = false;
+    int p = s.pair(i,l);
+    for (int n=l; n<=u; n++, p++)
+      for (int e=s.fst(p); e<s.lst(p); e++) {
+        Word w = words[s.widx(e)] & ~s.bits(e);
+        if (w != words[s.widx(e)]) {
+          words[s.widx(e)] = w; changed = true;
+        }
+      }
+    if (changed)
+      compress();
+    return changed;
+  }
+
+  template<class View>
+  forceinline bool
+  Compact<View>::reset(Space& home, int i) {
+    Region r(home);
+    Word* mask = r.alloc<Word>(s.words());
+    for (int k=limit; k--; )
+      mask[index[k]] = 0;
+    for (ViewValues<View> n(x[i]); n(); ++n) {
+      int p = s.pair(i,n.val());
+      for (int e=s.fst(p); e<s.lst(p); e++)
+        if (words[s.widx(e)] != 0)
+          mask[s.widx(e)] |= s.bits(e);
+    }
+    bool changed = false;
+    for (int k=limit; k--; ) {
+      Word w = words[index[k]] & mask[index[k]];
+      if (w != words[index[k]]) {
+        words[index[k]] = w; changed = true;
+      }
+    }
+    if (changed)
+      compress();
+    return changed;
+  }
+
+  template<class View>
+  forceinline bool
+  Compact<View>::supported(int i, int n) {
+    int p = s.pair(i,n);
+    int r = s.res(p);
+    if ((r < s.lst(p)) && ((words[s.widx(r)] & s.bits(r)) != 0))
+      return true;
+    for (int e=s.fst(p); e<s.lst(p); e++)
+      if ((words[s.widx(e)] & s.bits(e)) != 0) {
+        s.res(p,e);
+        return true;
+      }
+    return false;
+  }
+
+  template<class View>
+  ExecStatus
+  Compact<View>::advise(Space& home, Advisor& a, const Delta& d) {
+    int i = static_cast<CTAdvisor&>(a).i;
+    bool changed;
+    if (x[i].any(d) ||
+        (static_cast<unsigned int>(x[i].max(d)-x[i].min(d)) >= x[i].size()))
+      changed = reset(home,i);
+    else
+      changed = remove(i,x[i].min(d),x[i].max(d));
+    if (limit == 0)
+      return ES_FAILED;
+    if (!changed)
+      return ES_FIX;
+    touched = ((touched == -1) || (touched == i)) ? i : -2;
+    return ES_NOFIX;
+  }
+
+  template<class View>
+  ExecStatus
+  Compact<View>::propagate(Space& home, const ModEventDelta&) {
+    int t = touched;
+    touched = -1;
+    Region r(home);
+    unsigned int m = 0;
+    for (int i=x.size(); i--; )
+      m = std::max(m,x[i].size());
+    int* nq = r.alloc<int>(m);
+    for (int i=0; i<x.size(); i++)
+      if (!x[i].assigned() && (i != t)) {
+        int n = 0;
+        for (ViewValues<View> v(x[i]); v(); ++v)
+          if (!supported(i,v.val()))
+            nq[n++] = v.val();
+        if (n > 0) {
+          Iter::Values::Array rv(nq,n);
+          GECODE_ME_CHECK(x[i].minus_v(home,rv,false));
+        }
+      }
+    for (int i=x.size(); i--; )
+      if (!x[i].assigned())
+        return (touched == -1) ? ES_FIX : ES_NOFIX;
+    return home.ES_SUBSUMED(*this);
+  }
+
+  template<class View>
+  size_t
+  Compact<View>::dispose(Space& home) {
+    c.dispose(home);
+    home.free<Word>(words,s.words());
+    home.free<int>(index,s.words());
+    s.~Supports();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View>
+  ExecStatus
+  Compact<View>::post(Home home, ViewArray<View>& x, const TupleSet& t) {
+    // All variables in the correct domain
+    for (int i = x.size(); i--; ) {
+      GECODE_ME_CHECK(x[i].gq(home, t.min()));
+      GECODE_ME_CHECK(x[i].lq(home, t.max()));
+    }
+    Supports s(home,x,t);
+    if (s.words() == 0)
+      return ES_FAILED;
+    (void) new (home) Compact<View>(home,x,s);
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -55,7 +55,7 @@ namespace Gecode {
   nooverlap(Home home, 
             const IntVarArgs& x, const IntArgs& w, 
             const IntVarArgs& y, const IntArgs& h,
-            IntConLevel) {
+            IntConLevel icl) {
     using namespace Int;
     using namespace NoOverlap;
     if ((x.size() != w.size()) || (x.size() != y.size()) || 
@@ -78,8 +78,12 @@ namespace Gecode {
       b[i][1] = FixDim(y[i],h[i]);
     }
 
-    GECODE_ES_FAIL((
-      NoOverlap::ManProp<ManBox<FixDim,2> >::post(home,b,x.size())));
+    if ((icl == ICL_BND) || (icl == ICL_DOM))
+      GECODE_ES_FAIL((
+        NoOverlap::SweepProp<ManBox<FixDim,2> >::post(home,b,x.size())));
+    else
+      GECODE_ES_FAIL((
+        NoOverlap::ManProp<ManBox<FixDim,2> >::post(home,b,x.size())));
   }
 
   void
@@ -87,7 +91,7 @@ namespace Gecode {
             const IntVarArgs& x, const IntArgs& w, 
             const IntVarArgs& y, const IntArgs& h,
             const BoolVarArgs& m,
-            IntConLevel) {
+            IntConLevel icl) {
     using namespace Int;
     using namespace NoOverlap;
     if ((x.size() != w.size()) || (x.size() != y.size()) ||
@@ -123,7 +127,12 @@ namespace Gecode {
           b[n][1] = FixDim(y[i],h[i]);
           n++;
         }
-      GECODE_ES_FAIL((NoOverlap::ManProp<ManBox<FixDim,2> >::post(home,b,n)));
+      if ((icl == ICL_BND) || (icl == ICL_DOM))
+        GECODE_ES_FAIL((
+          NoOverlap::SweepProp<ManBox<FixDim,2> >::post(home,b,n)));
+      else
+        GECODE_ES_FAIL((
+          NoOverlap::ManProp<ManBox<FixDim,2> >::post(home,b,n)));
     }
   }
 
@@ -131,7 +140,7 @@ namespace Gecode {
   nooverlap(Home home, 
             const IntVarArgs& x0, const IntVarArgs& w, const IntVarArgs& x1,
             const IntVarArgs& y0, const IntVarArgs& h, const IntVarArgs& y1,
-            IntConLevel) {
+            IntConLevel icl) {
     using namespace Int;
     using namespace NoOverlap;
     if ((x0.size() != w.size())  || (x0.size() != x1.size()) || 
@@ -151,7 +160,7 @@ namespace Gecode {
         wc[i] = w[i].val();
         hc[i] = h[i].val();
       }
-      nooverlap(home, x0, wc, y0, hc);
+      nooverlap(home, x0, wc, y0, hc, icl);
     } else {
       ManBox<FlexDim,2>* b 
         = static_cast<Space&>(home).alloc<ManBox<FlexDim,2> >(x0.size());
@@ -159,8 +168,12 @@ namespace Gecode {
         b[i][0] = FlexDim(x0[i],w[i],x1[i]);
         b[i][1] = FlexDim(y0[i],h[i],y1[i]);
       }
-      GECODE_ES_FAIL((
-        NoOverlap::ManProp<ManBox<FlexDim,2> >::post(home,b,x0.size())));
+      if ((icl == ICL_BND) || (icl == ICL_DOM))
+        GECODE_ES_FAIL((
+          NoOverlap::SweepProp<ManBox<FlexDim,2> >::post(home,b,x0.size())));
+      else
+        GECODE_ES_FAIL((
+          NoOverlap::ManProp<ManBox<FlexDim,2> >::post(home,b,x0.size())));
     }
   }
 
@@ -169,7 +182,7 @@ namespace Gecode {
             const IntVarArgs& x0, const IntVarArgs& w, const IntVarArgs& x1,
             const IntVarArgs& y0, const IntVarArgs& h, const IntVarArgs& y1,
             const BoolVarArgs& m,
-            IntConLevel) {
+            IntConLevel icl) {
     using namespace Int;
     using namespace NoOverlap;
     if ((x0.size() != w.size())  || (x0.size() != x1.size()) || 
@@ -189,7 +202,7 @@ namespace Gecode {
         wc[i] = w[i].val();
         hc[i] = h[i].val();
       }
-      nooverlap(home, x0, wc, y0, hc, m);
+      nooverlap(home, x0, wc, y0, hc, m, icl);
     } else if (optional(m)) {
       OptBox<FlexDim,2>* b 
         = static_cast<Space&>(home).alloc<OptBox<FlexDim,2> >(x0.size());
@@ -210,7 +223,12 @@ namespace Gecode {
           b[n][1] = FlexDim(y0[i],h[i],y1[i]);
           n++;
         }
-      GECODE_ES_FAIL((NoOverlap::ManProp<ManBox<FlexDim,2> >::post(home,b,n)));
+      if ((icl == ICL_BND) || (icl == ICL_DOM))
+        GECODE_ES_FAIL((
+          NoOverlap::SweepProp<ManBox<FlexDim,2> >::post(home,b,n)));
+      else
+        GECODE_ES_FAIL((
+          NoOverlap::ManProp<ManBox<FlexDim,2> >::post(home,b,n)));
     }
   }
 
@@ -56,8 +56,6 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     IntView c;
     /// Size
     int s;
-    /// Modify smallest start coordinate
-    ExecStatus ssc(Space& home, int n);
     /// Modify largest end coordinate
     ExecStatus lec(Space& home, int n);
     /// Dimension must not overlap with coordinates \a n to \a m
@@ -76,6 +74,13 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     int sec(void) const;
     /// Return largest end coordinate
     int lec(void) const;
+    /// Return smallest size
+    int size(void) const;
+
+    /// Modify smallest start coordinate
+    ExecStatus ssc(Space& home, int n);
+    /// Modify largest start coordinate
+    ExecStatus lsc(Space& home, int n);
 
     /// Dimension must not overlap with \a d
     ExecStatus nooverlap(Space& home, FixDim& d);
@@ -100,8 +105,6 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     IntView s;
     /// End coordinate
     IntView c1;
-    /// Modify smallest start coordinate
-    ExecStatus ssc(Space& home, int n);
     /// Modify largest end coordinate
     ExecStatus lec(Space& home, int n);
     /// Dimension must not overlap with coordinates \a n to \a m
@@ -120,6 +123,13 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     int sec(void) const;
     /// Return largest end coordinate
     int lec(void) const;
+    /// Return smallest size
+    int size(void) const;
+
+    /// Modify smallest start coordinate
+    ExecStatus ssc(Space& home, int n);
+    /// Modify largest start coordinate
+    ExecStatus lsc(Space& home, int n);
 
     /// Dimension must not overlap with \a d
     ExecStatus nooverlap(Space& home, FlexDim& d);
@@ -172,6 +182,18 @@ namespace Gecode { namespace Int { namespace NoOverlap {
 
     /// Propagate that this box does not overlap with \a b
     ExecStatus nooverlap(Space& home, ManBox<Dim,n>& b);
+    /**
+     * \brief Propagate by sweeping over forbidden regions
+     *
+     * Prunes the smallest (if \a inc is true) or largest (otherwise)
+     * start coordinate of dimension \a k by sweeping a point over the
+     * \a m forbidden regions stored in \a l and \a h: region \a j
+     * forbids the start coordinates \a l[\a j*n+\a i] to
+     * \a h[\a j*n+\a i] in dimension \a i. Dimension \a k is the
+     * most significant dimension for the sweep.
+     */
+    ExecStatus sweep(Space& home, int k, bool inc,
+                     const int* l, const int* h, int m);
 
     /// Update box during cloning
     void update(Space& home, bool share, ManBox<Dim,n>& r);
@@ -277,6 +299,39 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     virtual size_t dispose(Space& home);
   };
 
+  /**
+   * \brief No-overlap propagator for mandatory boxes based on sweeping
+   *
+   * Finds the pairs of boxes that still might overlap by a sweep-line
+   * over the first dimension and propagates pairwise for them. In
+   * addition, the start coordinates of each box are pruned in all
+   * dimensions by sweeping a point over the forbidden regions induced
+   * by the compulsory parts of its neighbors.
+   *
+   * Requires \code #include <gecode/int/no-overlap.hh> \endcode
+   *
+   * \ingroup FuncIntProp
+   */
+  template<class Box>
+  class SweepProp : public Base<Box> {
+  protected:
+    using Base<Box>::b;
+    using Base<Box>::n;
+    /// Constructor for posting
+    SweepProp(Home home, Box* b, int n);
+    /// Constructor for cloning \a p
+    SweepProp(Space& home, bool share, SweepProp<Box>& p);
+  public:
+    /// Post propagator for boxes \a b
+    static ExecStatus post(Home home, Box* b, int n);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home, bool share);
+    /// Destructor
+    virtual size_t dispose(Space& home);
+  };
+
   /**
    * \brief No-overlap propagator for optional boxes
    *
@@ -310,6 +365,7 @@ namespace Gecode { namespace Int { namespace NoOverlap {
 
 #include <gecode/int/no-overlap/base.hpp>
 #include <gecode/int/no-overlap/man.hpp>
+#include <gecode/int/no-overlap/sweep.hpp>
 #include <gecode/int/no-overlap/opt.hpp>
 
 #endif
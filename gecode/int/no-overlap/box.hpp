@@ -119,6 +119,79 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     return ES_FAILED;
   }
 
+  template<class Dim, int n>
+  ExecStatus
+  ManBox<Dim,n>::sweep(Space& home, int k, bool inc,
+                       const int* l, const int* h, int m) {
+    // Sweep point and where to jump next
+    int c[n], e[n];
+    if (inc) {
+      for (int i=0; i<n; i++) {
+        c[i] = d[i].ssc(); e[i] = d[i].lsc()+1;
+      }
+    } else {
+      for (int i=0; i<n; i++) {
+        c[i] = d[i].lsc(); e[i] = d[i].ssc()-1;
+      }
+    }
+
+    // Regions that intersect the sweep point in dimension k
+    Region r(home);
+    int* a = r.alloc<int>(m);
+    int na = 0;
+    for (int f=0; f<m; f++)
+      if ((l[f*n+k] <= c[k]) && (c[k] <= h[f*n+k]))
+        a[na++] = f;
+
+    while (true) {
+      // Find forbidden region containing the sweep point
+      int f = -1;
+      for (int g=0; g<na; g++) {
+        int i = 0;
+        while ((i < n) && (l[a[g]*n+i] <= c[i]) && (c[i] <= h[a[g]*n+i]))
+          i++;
+        if (i == n) {
+          f = a[g]; break;
+        }
+      }
+      if (f < 0)
+        break;
+      // Advance the sweep point, least significant dimension first
+      int j = n;
+      if (inc) {
+        for (int i=0; i<n; i++)
+          e[i] = std::min(e[i],h[f*n+i]+1);
+        while (j--) {
+          int i = (k+j) % n;
+          c[i] = e[i]; e[i] = d[i].lsc()+1;
+          if (c[i] <= d[i].lsc())
+            break;
+          c[i] = d[i].ssc();
+        }
+      } else {
+        for (int i=0; i<n; i++)
+          e[i] = std::max(e[i],l[f*n+i]-1);
+        while (j--) {
+          int i = (k+j) % n;
+          c[i] = e[i]; e[i] = d[i].ssc()-1;
+          if (c[i] >= d[i].ssc())
+            break;
+          c[i] = d[i].lsc();
+        }
+      }
+      if (j < 0)
+        return ES_FAILED;
+      if (j == 0) {
+        // Sweep point has moved in dimension k
+        na = 0;
+        for (int g=0; g<m; g++)
+          if ((l[g*n+k] <= c[k]) && (c[k] <= h[g*n+k]))
+            a[na++] = g;
+      }
+    }
+    return inc ? d[k].ssc(home,c[k]) : d[k].lsc(home,c[k]);
+  }
+
   template<class Dim, int n>
   forceinline void
   ManBox<Dim,n>::update(Space& home, bool share, ManBox<Dim,n>& b) {
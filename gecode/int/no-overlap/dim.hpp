@@ -64,6 +64,10 @@ namespace Gecode { namespace Int { namespace NoOverlap {
   FixDim::lec(void) const {
     return c.max() + s;
   }
+  forceinline int 
+  FixDim::size(void) const {
+    return s;
+  }
 
   forceinline ExecStatus
   FixDim::ssc(Space& home, int n) {
@@ -71,6 +75,11 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     return ES_OK;
   }
   forceinline ExecStatus
+  FixDim::lsc(Space& home, int n) {
+    GECODE_ME_CHECK(c.lq(home, n));
+    return ES_OK;
+  }
+  forceinline ExecStatus
   FixDim::lec(Space& home, int n) {
     GECODE_ME_CHECK(c.lq(home, n - s));
     return ES_OK;
@@ -137,6 +146,10 @@ namespace Gecode { namespace Int { namespace NoOverlap {
   FlexDim::lec(void) const {
     return c1.max();
   }
+  forceinline int 
+  FlexDim::size(void) const {
+    return s.min();
+  }
 
   forceinline ExecStatus
   FlexDim::ssc(Space& home, int n) {
@@ -144,6 +157,11 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     return ES_OK;
   }
   forceinline ExecStatus
+  FlexDim::lsc(Space& home, int n) {
+    GECODE_ME_CHECK(c0.lq(home, n));
+    return ES_OK;
+  }
+  forceinline ExecStatus
   FlexDim::lec(Space& home, int n) {
     GECODE_ME_CHECK(c1.lq(home, n));
     return ES_OK;
@@ -0,0 +1,213 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Int { namespace NoOverlap {
+
+  /// Sort order for boxes by smallest start coordinate in first dimension
+  template<class Box>
+  class SweepOrder {
+  protected:
+    /// The boxes
+    const Box* b;
+  public:
+    /// Initialize with boxes \a b
+    SweepOrder(const Box* b);
+    /// Sort order
+    bool operator ()(int i, int j) const;
+  };
+
+  template<class Box>
+  forceinline
+  SweepOrder<Box>::SweepOrder(const Box* b0) : b(b0) {}
+  template<class Box>
+  forceinline bool
+  SweepOrder<Box>::operator ()(int i, int j) const {
+    return b[i][0].ssc() < b[j][0].ssc();
+  }
+
+
+  template<class Box>
+  forceinline
+  SweepProp<Box>::SweepProp(Home home, Box* b, int n)
+    : Base<Box>(home, b, n) {}
+
+  template<class Box>
+  inline ExecStatus
+  SweepProp<Box>::post(Home home, Box* b, int n) {
+    if (n > 1)
+      (void) new (home) SweepProp<Box>(home,b,n);
+    return ES_OK;
+  }
+
+  template<class Box>
+  forceinline size_t 
+  SweepProp<Box>::dispose(Space& home) {
+    (void) Base<Box>::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  template<class Box>
+  forceinline
+  SweepProp<Box>::SweepProp(Space& home, bool shared, SweepProp<Box>& p) 
+    : Base<Box>(home, shared, p, p.n) {}
+
+  template<class Box>
+  Actor* 
+  SweepProp<Box>::copy(Space& home, bool share) {
+    return new (home) SweepProp<Box>(home,share,*this);
+  }
+
+  template<class Box>
+  ExecStatus 
+  SweepProp<Box>::propagate(Space& home, const ModEventDelta&) {
+    Region r(home);
+
+    // Sort boxes by their smallest start coordinate in the first dimension
+    int* s = r.alloc<int>(n);
+    for (int i=n; i--; )
+      s[i] = i;
+    SweepOrder<Box> so(b);
+    Support::quicksort<int,SweepOrder<Box> >(s,n,so);
+
+    // Number of boxes a box might still overlap with
+    int* nb = r.alloc<int>(n);
+    for (int i=n; i--; )
+      nb[i] = 0;
+
+    {
+      // Largest end coordinates in the first dimension before propagation
+      int* lec = r.alloc<int>(n);
+      for (int i=n; i--; )
+        lec[i] = b[i][0].lec();
+      // Boxes that extend beyond the sweep line in the first dimension
+      int* a = r.alloc<int>(n);
+      int na = 0;
+      for (int l=0; l<n; l++) {
+        int i = s[l];
+        int ssc = b[i][0].ssc();
+        int j = 0;
+        while (j < na)
+          if (lec[a[j]] <= ssc) {
+            a[j] = a[--na];
+          } else {
+            if (!b[i].nooverlap(b[a[j]])) {
+              GECODE_ES_CHECK(b[i].nooverlap(home,b[a[j]]));
+              nb[i]++; nb[a[j]]++;
+            }
+            j++;
+          }
+        a[na++] = i;
+      }
+    }
+
+    // Sweep against the regions forbidden by the other boxes
+    {
+      const int d = Box::dim();
+      // Compulsory parts: box cb[j] covers cl[j*d+k] to ch[j*d+k]-1
+      int* cb = r.alloc<int>(n);
+      int* cl = r.alloc<int>(n*d);
+      int* ch = r.alloc<int>(n*d);
+      int c = 0;
+      for (int j=0; j<n; j++) {
+        int k = 0;
+        while ((k < d) && (b[j][k].lsc() < b[j][k].sec())) {
+          cl[c*d+k] = b[j][k].lsc(); ch[c*d+k] = b[j][k].sec();
+          k++;
+        }
+        if (k == d)
+          cb[c++] = j;
+      }
+      // Forbidden regions for the start coordinates of a box
+      int* fl = r.alloc<int>(n*d);
+      int* fh = r.alloc<int>(n*d);
+      // Start coordinates and size of a box
+      int* ssc = r.alloc<int>(d);
+      int* lsc = r.alloc<int>(d);
+      int* sz = r.alloc<int>(d);
+      for (int i=n; i--; ) {
+        if (nb[i] == 0)
+          continue;
+        // Only unassigned start coordinates can be pruned
+        bool a = true;
+        for (int k=0; k<d; k++)
+          if (b[i][k].ssc() != b[i][k].lsc())
+            a = false;
+        if (a)
+          continue;
+        for (int k=0; k<d; k++) {
+          ssc[k] = b[i][k].ssc(); lsc[k] = b[i][k].lsc();
+          sz[k] = b[i][k].size();
+        }
+        int m = 0;
+        for (int j=0; j<c; j++)
+          if (cb[j] != i) {
+            int k = 0;
+            while (k < d) {
+              int l = cl[j*d+k] - sz[k] + 1, h = ch[j*d+k] - 1;
+              if ((l > lsc[k]) || (h < ssc[k]))
+                break;
+              fl[m*d+k] = l; fh[m*d+k] = h;
+              k++;
+            }
+            if (k == d)
+              m++;
+          }
+        if (m > 0)
+          for (int k=0; k<d; k++) {
+            GECODE_ES_CHECK(b[i].sweep(home,k,true,fl,fh,m));
+            GECODE_ES_CHECK(b[i].sweep(home,k,false,fl,fh,m));
+          }
+      }
+    }
+
+    // Eliminate boxes that do not overlap with any other box
+    for (int i=n; i--; )
+      if (nb[i] == 0) {
+        b[i].cancel(home, *this);
+        b[i] = b[--n];
+      }
+    if (n < 2)
+      return home.ES_SUBSUMED(*this);
+
+    return ES_NOFIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
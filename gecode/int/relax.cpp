@@ -0,0 +1,136 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int.hh>
+
+namespace Gecode { namespace Int { namespace Relax {
+
+  /// Whether a variable is fixed for relaxation rate \a p
+  forceinline bool
+  fix(Rnd& r, double p) {
+    return r(1000000U) >= static_cast<unsigned int>(p * 1000000.0);
+  }
+
+  /// Relax \a x with respect to \a sx by randomly fixing variables
+  template<class VarArgs>
+  forceinline bool
+  random(Home home, const VarArgs& x, const VarArgs& sx, Rnd r, double p) {
+    bool fixed = false;
+    for (int i=0; i<x.size(); i++)
+      if (!x[i].assigned() && fix(r,p)) {
+        rel(home, x[i], IRT_EQ, sx[i].val());
+        fixed = true;
+      }
+    return fixed;
+  }
+
+  /// Relax \a x with respect to \a sx by propagation-guided fixing
+  template<class VarArgs>
+  forceinline bool
+  guided(Home home, const VarArgs& x, const VarArgs& sx, Rnd r, double p) {
+    Space& s = home;
+    int n = x.size();
+    // Number of variables to be fixed
+    int m = static_cast<int>((1.0 - p) * n + 0.5);
+    Region re(s);
+    unsigned int* d = re.alloc<unsigned int>(n);
+    for (int i=0; i<n; i++)
+      d[i] = x[i].size();
+    bool fixed = false;
+    while ((m > 0) && !s.failed()) {
+      // Select variable whose domain has been reduced most by propagation
+      int j = -1;
+      double b = 0.0;
+      int u = 0;
+      for (int i=0; i<n; i++)
+        if (!x[i].assigned()) {
+          u++;
+          double c = 1.0 - static_cast<double>(x[i].size()) / d[i];
+          if (c > b) {
+            b = c; j = i;
+          }
+        }
+      if (u == 0)
+        break;
+      if (j < 0) {
+        // Select a random unassigned variable
+        int k = static_cast<int>(r(static_cast<unsigned int>(u)));
+        for (int i=0; i<n; i++)
+          if (!x[i].assigned() && (k-- == 0)) {
+            j = i; break;
+          }
+      }
+      for (int i=0; i<n; i++)
+        d[i] = x[i].size();
+      rel(home, x[j], IRT_EQ, sx[j].val());
+      fixed = true;
+      m--;
+      (void) s.status();
+    }
+    return fixed;
+  }
+
+}}}
+
+namespace Gecode {
+
+  bool
+  relax(Home home, const IntVarArgs& x, const IntVarArgs& sx, Rnd r,
+        double p, bool pg) {
+    if (x.size() != sx.size())
+      throw Int::ArgumentSizeMismatch("Int::relax");
+    if (home.failed())
+      return false;
+    return pg ? Int::Relax::guided(home,x,sx,r,p) :
+      Int::Relax::random(home,x,sx,r,p);
+  }
+
+  bool
+  relax(Home home, const BoolVarArgs& x, const BoolVarArgs& sx, Rnd r,
+        double p, bool pg) {
+    if (x.size() != sx.size())
+      throw Int::ArgumentSizeMismatch("Int::relax");
+    if (home.failed())
+      return false;
+    return pg ? Int::Relax::guided(home,x,sx,r,p) :
+      Int::Relax::random(home,x,sx,r,p);
+  }
+
+}
+
+// STATISTICS: int-post
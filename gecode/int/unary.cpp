@@ -144,7 +144,7 @@ namespace Gecode {
       TaskArray<OptFixPTask> t(home,s.size());
       for (int i=s.size(); i--; )
         t[i].init(s[i],p[i],m[i]);
-      GECODE_ES_FAIL(OptProp<OptFixPTask>::post(home,t));
+      GECODE_ES_FAIL(OptProp<OptFixPTask>::post(home,t,icl == ICL_DOM));
     }
   }
 
@@ -183,12 +183,14 @@ namespace Gecode {
         TaskArray<OptFixPTask> tasks(home,flex.size());
         for (int i=flex.size(); i--; )
           tasks[i].init(flex[i],fix[i],m[i]);
-        GECODE_ES_FAIL(OptProp<OptFixPTask>::post(home,tasks));
+        GECODE_ES_FAIL(OptProp<OptFixPTask>::post(home,tasks,
+                                                     icl == ICL_DOM));
       } else {
         TaskArray<OptFixPSETask> tasks(home,flex.size());
         for (int i=flex.size(); i--;)
           tasks[i].init(t[i],flex[i],fix[i],m[i]);
-        GECODE_ES_FAIL(OptProp<OptFixPSETask>::post(home,tasks));
+        GECODE_ES_FAIL(OptProp<OptFixPSETask>::post(home,tasks,
+                                                       icl == ICL_DOM));
       }
     }
   }
@@ -249,7 +251,7 @@ namespace Gecode {
       TaskArray<OptFlexTask> t(home,s.size());
       for (int i=s.size(); i--; )
         t[i].init(s[i],p[i],e[i],m[i]);
-      GECODE_ES_FAIL(OptProp<OptFlexTask>::post(home,t));
+      GECODE_ES_FAIL(OptProp<OptFlexTask>::post(home,t,icl == ICL_DOM));
     }
   }
 
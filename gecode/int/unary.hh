@@ -134,6 +134,10 @@ namespace Gecode { namespace Int { namespace Unary {
     void subscribe(Space& home, Propagator& p, PropCond pc=Int::PC_INT_BND);
     /// Cancel subscription of propagator \a p for task
     void cancel(Space& home, Propagator& p, PropCond pc=Int::PC_INT_BND);
+    /// Subscribe advisor \a a to task
+    void subscribe(Space& home, Advisor& a);
+    /// Cancel subscription of advisor \a a for task
+    void cancel(Space& home, Advisor& a);
     //@}
 
   };
@@ -354,6 +358,10 @@ namespace Gecode { namespace Int { namespace Unary {
     void subscribe(Space& home, Propagator& p, PropCond pc=Int::PC_INT_BND);
     /// Cancel subscription of propagator \a p for task
     void cancel(Space& home, Propagator& p, PropCond pc=Int::PC_INT_BND);
+    /// Subscribe advisor \a a to task
+    void subscribe(Space& home, Advisor& a);
+    /// Cancel subscription of advisor \a a for task
+    void cancel(Space& home, Advisor& a);
     //@}
 
   };
@@ -775,6 +783,9 @@ namespace Gecode { namespace Int { namespace Unary {
   /// Propagate by edge finding
   template<class Task>
   ExecStatus edgefinding(Space& home, TaskArray<Task>& t);
+  /// Propagate by edge finding for optional tasks
+  template<class OptTask>
+  ExecStatus edgefinding(Space& home, Propagator& p, TaskArray<OptTask>& t);
 
 
   /**
@@ -810,8 +821,10 @@ namespace Gecode { namespace Int { namespace Unary {
   class OptProp : public TaskProp<OptTask,Int::PC_INT_BND> {
   protected:
     using TaskProp<OptTask,Int::PC_INT_BND>::t;
+    /// Whether edge finding also takes optional tasks into account
+    bool oef;
     /// Constructor for creation
-    OptProp(Home home, TaskArray<OptTask>& t);
+    OptProp(Home home, TaskArray<OptTask>& t, bool oef);
     /// Constructor for cloning \a p
     OptProp(Space& home, bool shared, OptProp& p);
   public:
@@ -819,8 +832,15 @@ namespace Gecode { namespace Int { namespace Unary {
     virtual Actor* copy(Space& home, bool share);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator that schedules tasks on unary resource
-    static ExecStatus post(Home home, TaskArray<OptTask>& t);
+    /**
+     * \brief Post propagator that schedules tasks on unary resource
+     *
+     * If \a oef is true, edge finding also takes optional tasks into
+     * account and excludes them if they can neither run before nor after
+     * a set of mandatory tasks. Otherwise, edge finding only considers
+     * mandatory tasks.
+     */
+    static ExecStatus post(Home home, TaskArray<OptTask>& t, bool oef);
   };
 
 }}}
@@ -72,6 +72,56 @@ namespace Gecode { namespace Int { namespace Unary {
     TaskViewArray<typename TaskTraits<Task>::TaskViewBwd> b(t);
     return edgefinding(home,b);
   }
+
+  template<class OptTaskView>
+  forceinline ExecStatus
+  edgefinding(Space& home, TaskViewArray<OptTaskView>& t, bool& to_purge) {
+    Region r(home);
+
+    ManTaskViewIter<OptTaskView,STO_LCT,false> q(r,t);
+    if (!q())
+      return ES_OK;
+
+    // Mandatory tasks are in omega, optional tasks in lambda
+    OmegaLambdaTree<OptTaskView> ol(r,t);
+    for (int i=t.size(); i--; )
+      if (!t[i].mandatory())
+        ol.shift(i);
+
+    while (q()) {
+      int j = q.task();
+      if (ol.ect() > t[j].lct())
+        return ES_FAILED;
+      while (!ol.lempty() && (ol.lect() > t[j].lct())) {
+        int i = ol.responsible();
+        if (t[i].mandatory()) {
+          GECODE_ME_CHECK(t[i].est(home,ol.ect()));
+        } else if ((t[i].lct() <= t[j].lct()) || (ol.ect() > t[i].lst())) {
+          // Optional task can neither run before nor after omega
+          GECODE_ME_CHECK(t[i].excluded(home));
+          to_purge = true;
+        }
+        ol.lremove(i);
+      }
+      ol.shift(j);
+      ++q;
+    }
+
+    return ES_OK;
+  }
+
+  template<class OptTask>
+  ExecStatus
+  edgefinding(Space& home, Propagator& p, TaskArray<OptTask>& t) {
+    bool to_purge = false;
+    TaskViewArray<typename TaskTraits<OptTask>::TaskViewFwd> f(t);
+    GECODE_ES_CHECK(edgefinding(home,f,to_purge));
+    TaskViewArray<typename TaskTraits<OptTask>::TaskViewBwd> b(t);
+    GECODE_ES_CHECK(edgefinding(home,b,to_purge));
+    if (to_purge)
+      GECODE_ES_CHECK((purge<OptTask,Int::PC_INT_BND>(home,p,t)));
+    return ES_OK;
+  }
     
 }}}
 
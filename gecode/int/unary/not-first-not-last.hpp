@@ -111,8 +111,8 @@ namespace Gecode { namespace Int { namespace Unary {
       if (t[i].mandatory()) {
         GECODE_ME_CHECK(t[i].lct(home,lct[i]));
       } else if (lct[i] < t[i].ect()) {
-        //        GECODE_ME_CHECK(t[i].excluded(home));
-        //        t[i].cancel(home,p); t[i]=t[--n];
+        GECODE_ME_CHECK(t[i].excluded(home));
+        t[i].cancel(home,p,Int::PC_INT_BND); t[i]=t[--n];
       }
     t.size(n);
 
@@ -41,17 +41,17 @@ namespace Gecode { namespace Int { namespace Unary {
   
   template<class OptTask>
   forceinline
-  OptProp<OptTask>::OptProp(Home home, TaskArray<OptTask>& t)
-    : TaskProp<OptTask,Int::PC_INT_BND>(home,t) {}
+  OptProp<OptTask>::OptProp(Home home, TaskArray<OptTask>& t, bool oef0)
+    : TaskProp<OptTask,Int::PC_INT_BND>(home,t), oef(oef0) {}
 
   template<class OptTask>
   forceinline
   OptProp<OptTask>::OptProp(Space& home, bool shared, OptProp<OptTask>& p) 
-    : TaskProp<OptTask,Int::PC_INT_BND>(home,shared,p) {}
+    : TaskProp<OptTask,Int::PC_INT_BND>(home,shared,p), oef(p.oef) {}
 
   template<class OptTask>
   forceinline ExecStatus 
-  OptProp<OptTask>::post(Home home, TaskArray<OptTask>& t) {
+  OptProp<OptTask>::post(Home home, TaskArray<OptTask>& t, bool oef) {
     int m=0, o=0;
     for (int i=t.size(); i--; ) {
       if (t[i].mandatory())
@@ -66,7 +66,7 @@ namespace Gecode { namespace Int { namespace Unary {
       return ManProp<typename TaskTraits<OptTask>::ManTask>::post(home,mt);
     }
     if (o+m > 1)
-      (void) new (home) OptProp<OptTask>(home,t);
+      (void) new (home) OptProp<OptTask>(home,t,oef);
     return ES_OK;
   }
 
@@ -88,27 +88,40 @@ namespace Gecode { namespace Int { namespace Unary {
     GECODE_ES_CHECK(detectable(home,*this,t));
     GECODE_ES_CHECK(notfirstnotlast(home,*this,t));
 
-    // Partition into mandatory and optional activities
-    int n = t.size();
-    int i=0, j=n-1;
-    while (true) {
-      while ((i < n) && t[i].mandatory()) i++;
-      while ((j >= 0) && !t[j].mandatory()) j--;
-      if (i >= j) break;
-      std::swap(t[i],t[j]);
-    }
+    if (oef) {
+      GECODE_ES_CHECK(edgefinding(home,*this,t));
+    } else {
+      // Partition into mandatory and optional activities
+      int n = t.size();
+      int i=0, j=n-1;
+      while (true) {
+        while ((i < n) && t[i].mandatory()) i++;
+        while ((j >= 0) && !t[j].mandatory()) j--;
+        if (i >= j) break;
+        std::swap(t[i],t[j]);
+      }
 
-    if (i > 1) {
-      // Truncate array to only contain mandatory tasks
-      t.size(i);
-      GECODE_ES_CHECK(edgefinding(home,t));
-      // Restore to also include optional tasks
-      t.size(n);
+      if (i > 1) {
+        // Truncate array to only contain mandatory tasks
+        t.size(i);
+        GECODE_ES_CHECK(edgefinding(home,t));
+        // Restore to also include optional tasks
+        t.size(n);
+      }
     }
 
     GECODE_ES_CHECK(subsumed(home,*this,t));
 
-    return ES_NOFIX;
+    // Rewrite to propagator for mandatory tasks if possible
+    for (int i=t.size(); i--; )
+      if (!t[i].mandatory())
+        return ES_NOFIX;
+    TaskArray<typename TaskTraits<OptTask>::ManTask> mt(home,t.size());
+    for (int i=t.size(); i--; )
+      mt[i].init(t[i]);
+    GECODE_REWRITE(*this,
+                   ManProp<typename TaskTraits<OptTask>::ManTask>
+                     ::post(home(*this),mt));
   }
 
 }}}
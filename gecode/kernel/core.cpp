@@ -110,8 +110,51 @@ namespace Gecode {
   VarImpDisposerBase* Space::vd[AllVarConf::idx_d];
 #endif
 
+  /*
+   * Shared objects and handles
+   *
+   */
+
+  void
+  SharedHandle::Group::add(Object* so) {
+    assert(so->frozen);
+    m.acquire();
+    for (unsigned int i=0; i<n; i++)
+      if (o[i] == so) {
+        m.release();
+        return;
+      }
+    if (n == size) {
+      unsigned int s = std::max(2U*size,4U);
+      o = heap.realloc<Object*>(o,size,s);
+      size = s;
+    }
+    (void) Support::Atomic::inc(so->use_cnt);
+    o[n++] = so;
+    m.release();
+  }
+
+  SharedHandle::Group::~Group(void) {
+    for (unsigned int i=0; i<n; i++)
+      if (Support::Atomic::dec(o[i]->use_cnt) == 0)
+        delete o[i];
+    heap.free<Object*>(o,size);
+  }
+
+  void
+  SharedHandle::freeze(Space& home) {
+    Object* so = object();
+    if (so == NULL)
+      return;
+    so->frozen = true;
+    if (home.sg == NULL)
+      home.sg = new Group;
+    home.sg->add(so);
+  }
+
+
   Space::Space(void)
-    : sm(new SharedMemory), mm(sm), _wmp_afc(0U) {
+    : sm(new SharedMemory), mm(sm), sg(NULL), _wmp_afc(0U) {
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
       _vars_d[i] = NULL;
@@ -129,6 +172,7 @@ namespace Gecode {
       pc.p.queue[i].init();
     pc.p.branch_id = reserved_branch_id+1;
     pc.p.n_sub = 0;
+    pc.p.n_enqueue = 0;
   }
 
   void
@@ -211,6 +255,8 @@ namespace Gecode {
   Space::flush(void) {
     // Flush malloc cache
     sm->flush();
+    // Flush chunks kept for all spaces
+    hcpool.flush();
   }
 
   Space::~Space(void) {
@@ -233,6 +279,9 @@ namespace Gecode {
       if (_vars_d[i] != NULL)
         vd[i]->dispose(*this, _vars_d[i]);
 #endif
+    // Release frozen shared objects
+    if ((sg != NULL) && sg->cancel())
+      delete sg;
     // Release memory from memory manager
     mm.release(sm);
     // Release shared memory
@@ -354,6 +403,8 @@ namespace Gecode {
     // No brancher with alternatives left, space is solved
     s = SS_SOLVED;
   exit:
+    stat.enqueue += pc.p.n_enqueue;
+    pc.p.n_enqueue = 0;
     stat.wmp = (wmp() > 0U);
     if (wmp() == 1U) 
       wmp(0U);
@@ -499,9 +550,11 @@ namespace Gecode {
   Space::Space(bool share, Space& s)
     : sm(s.sm->copy(share)), 
       mm(sm,s.mm,s.pc.p.n_sub*sizeof(Propagator**)),
-      gafc(s.gafc),
+      gafc(s.gafc), sg(s.sg),
       d_fst(&Actor::sentinel),
       _wmp_afc(s._wmp_afc) {
+    if (sg != NULL)
+      sg->subscribe();
 #ifdef GECODE_HAS_VAR_DISPOSE
     for (int i=0; i<AllVarConf::idx_d; i++)
       _vars_d[i] = NULL;
@@ -637,6 +690,7 @@ namespace Gecode {
     // Copy propagation only data
     c->pc.p.n_sub = pc.p.n_sub;
     c->pc.p.branch_id = pc.p.branch_id;
+    c->pc.p.n_enqueue = 0;
     return c;
   }
 
@@ -653,6 +707,15 @@ namespace Gecode {
   Space::slave(unsigned long int, const Space*) {
   }
 
+  void
+  Space::asset(unsigned int) {
+  }
+
+  bool
+  Space::relax(unsigned long int, const Space&, double) {
+    return false;
+  }
+
   void
   LocalObject::fwdcopy(Space& home, bool share) {
     ActorLink::cast(this)->prev(copy(home,share));
@@ -682,6 +745,25 @@ namespace Gecode {
       gafc.set(p.propagator().gafc,a);
   }
 
+  void
+  Space::afc_enqueue(Propagator* p) {
+    ActorLink::cast(p)->unlink();
+    int ac = p->cost(*this,p->u.med).ac;
+    double a = gafc.afc(p->gafc);
+    // Move to the next cheaper queue if more likely to fail than its first
+    if ((ac < PropCost::AC_MAX) && !pc.p.queue[ac+1].empty() &&
+        (a > gafc.afc(Propagator::cast(pc.p.queue[ac+1].next())->gafc)))
+      ac++;
+    ActorLink* c = &pc.p.queue[ac];
+    // Execute first if more likely to fail than the current first
+    if (!c->empty() && (a > gafc.afc(Propagator::cast(c->next())->gafc)))
+      c->head(ActorLink::cast(p));
+    else
+      c->tail(ActorLink::cast(p));
+    if (c > pc.p.active)
+      pc.p.active = c;
+  }
+
 
   bool
   NGL::notice(void) const {
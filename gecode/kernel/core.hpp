@@ -95,6 +95,8 @@ namespace Gecode {
       Object* fwd;
       /// The counter used for reference counting
       unsigned int use_cnt;
+      /// Whether the object is frozen (immutable)
+      bool frozen;
     public:
       /// Initialize
       Object(void);
@@ -107,8 +109,54 @@ namespace Gecode {
       /// Free memory allocated from heap
       static void  operator delete(void* p);
     };
+    /**
+     * \brief Group of spaces owning frozen shared objects
+     *
+     * All spaces obtained by cloning from the same space belong to
+     * the same group, regardless of whether the clones share or not.
+     * The group keeps a reference to each frozen object used by its
+     * spaces. Hence handles in clones can refer to frozen objects
+     * without copying them and without maintaining reference counts.
+     * A group can be used by spaces in different threads.
+     *
+     * \ingroup FuncSupportShared
+     */
+    class Group {
+    private:
+      /// Mutex for synchronizing access to the objects
+      Support::FastMutex m;
+      /// How many spaces use this group
+      unsigned int use_cnt;
+      /// Number of objects
+      unsigned int n;
+      /// Size of object array
+      unsigned int size;
+      /// The objects owned by the group
+      Object** o;
+    public:
+      /// Initialize for a single space
+      Group(void);
+      /// Add frozen object \a so (unless already owned by the group)
+      GECODE_KERNEL_EXPORT void add(Object* so);
+      /// Use group by one more space
+      void subscribe(void);
+      /// Release group by one space, return true if group must be deleted
+      bool cancel(void);
+      /// Release all objects owned by the group
+      GECODE_KERNEL_EXPORT ~Group(void);
+      /// Allocate memory from heap
+      static void* operator new(size_t s);
+      /// Free memory allocated from heap
+      static void  operator delete(void* p);
+    };
   private:
-    /// The shared object
+    /**
+     * \brief The shared object
+     *
+     * The pointer is marked if the handle does not hold a reference
+     * to the object, that is, if the object is frozen and owned by
+     * the group of the space the handle belongs to.
+     */
     Object* o;
     /// Subscribe handle to object
     void subscribe(void);
@@ -125,6 +173,17 @@ namespace Gecode {
     SharedHandle& operator =(const SharedHandle& sh);
     /// Updating during cloning
     void update(Space& home, bool share, SharedHandle& sh);
+    /**
+     * \brief Freeze shared object
+     *
+     * A frozen object must not be modified anymore. Clones of \a home
+     * then refer to the object instead of copying it, even if they
+     * do not share. The group of spaces \a home belongs to keeps the
+     * object alive.
+     */
+    GECODE_KERNEL_EXPORT void freeze(Space& home);
+    /// Test whether shared object is frozen
+    bool frozen(void) const;
     /// Destructor that maintains reference count
     ~SharedHandle(void);
   protected:
@@ -1274,6 +1333,8 @@ namespace Gecode {
   public:
     /// Number of propagator executions
     unsigned long int propagate;
+    /// Number of propagator queue operations
+    unsigned long int enqueue;
     /// Whether a weakly monotonic propagator might have been executed
     bool wmp;
     /// Initialize
@@ -1341,6 +1402,8 @@ namespace Gecode {
     MemoryManager mm;
     /// Global AFC information
     GlobalAFC gafc;
+    /// Group owning frozen shared objects (NULL if none)
+    SharedHandle::Group* sg;
     /// Doubly linked list of all propagators
     ActorLink pl;
     /// Doubly linked list of all branchers
@@ -1392,6 +1455,8 @@ namespace Gecode {
         unsigned int branch_id;
         /// Number of subscriptions
         unsigned int n_sub;
+        /// Number of queue operations since last status
+        unsigned long int n_enqueue;
       } p;
       /// Data available only during copying
       struct {
@@ -1407,6 +1472,9 @@ namespace Gecode {
     } pc;
     /// Put propagator \a p into right queue
     void enqueue(Propagator* p);
+    /// Put propagator \a p into queue according to cost and AFC
+    GECODE_KERNEL_EXPORT
+    void afc_enqueue(Propagator* p);
     /**
      * \name update, and dispose variables
      */
@@ -1433,10 +1501,11 @@ namespace Gecode {
     Actor** d_lst;
 
     /**
-     * \brief Number of weakly monotonic propagators and AFC flag
+     * \brief Number of weakly monotonic propagators and AFC flags
      *
      * The least significant bit encodes whether AFC information
-     * must be collected, the remaining bits encode counting for
+     * must be collected, the next bit whether propagators are
+     * scheduled according to AFC, the remaining bits encode counting for
      * weakly monotonic propagators as follows. If zero, none
      * exists. If one, then none exists right now but there has
      * been one since the last fixpoint computed. Otherwise, it
@@ -1448,6 +1517,8 @@ namespace Gecode {
     void afc_enable(void);
     /// Whether AFC information must be recorded
     bool afc_enabled(void) const;
+    /// Whether propagators are scheduled according to AFC
+    bool afc_scheduled(void) const;
     /// Set number of wmp propagators to \a n
     void wmp(unsigned int n);
     /// Return number of wmp propagators
@@ -1618,6 +1689,37 @@ namespace Gecode {
      */
     GECODE_KERNEL_EXPORT 
     virtual void slave(unsigned long int i, const Space* s);
+    /**
+     * \brief Asset configuration function for portfolio meta search engine
+     *
+     * A portfolio meta search engine calls this function on the
+     * space for each of its assets before search starts. \a i is
+     * the number of the asset. The function can be used to
+     * diversify the assets, for example by posting different
+     * branchers.
+     *
+     * The default function does nothing.
+     *
+     * \ingroup TaskModelScript
+     */
+    GECODE_KERNEL_EXPORT 
+    virtual void asset(unsigned int i);
+    /**
+     * \brief Relaxation function for large neighbourhood search
+     *
+     * A large neighbourhood search meta engine calls this function
+     * on its slave space before exploring neighbourhood \a i. \a s
+     * is the best solution found so far. The function should fix
+     * variables to their values in \a s such that each variable
+     * remains free with probability \a r. It must return whether
+     * some variable has been fixed.
+     *
+     * The default function does nothing and returns false.
+     *
+     * \ingroup TaskModelScript
+     */
+    GECODE_KERNEL_EXPORT 
+    virtual bool relax(unsigned long int i, const Space& s, double r);
     /**
      * \brief Allocate memory from heap for new space
      * \ingroup TaskModelScript
@@ -1716,6 +1818,18 @@ namespace Gecode {
      * \ingroup TaskSearch
      */
     Space* clone(bool share=true, CloneStatistics& stat=unused_clone) const;
+    /**
+     * \brief Create \a n clones of the space and store them in \a c
+     *
+     * The same as calling Space::clone \a n times. Search engines
+     * that need several clones of the same space at once (for
+     * example, for the assets of a portfolio) should use this
+     * function.
+     *
+     * \ingroup TaskSearch
+     */
+    void clone(Space** c, unsigned int n, bool share=true,
+               CloneStatistics& stat=unused_clone) const;
 
     /**
      * \brief Commit choice \a c for alternative \a a
@@ -2164,7 +2278,9 @@ namespace Gecode {
      *
      * All spaces that are obtained as non-shared clones from some same space
      * try to cache memory blocks from failed spaces. To minimize memory
-     * consumption, these blocks can be flushed.
+     * consumption, these blocks can be flushed. This also flushes
+     * the memory blocks kept in the global pool of heap chunks (see
+     * Gecode::HeapChunkPool).
      *
      */
     GECODE_KERNEL_EXPORT void flush(void);
@@ -2271,6 +2387,21 @@ namespace Gecode {
     /// Reset AFC to \a a
     GECODE_KERNEL_EXPORT
     void afc_set(double a);
+    /**
+     * \brief Set whether propagators are scheduled according to AFC
+     *
+     * By default, a propagator is scheduled according to the cost
+     * it reports. If \a b is true, the cost is calibrated by the
+     * afc of the propagator: a propagator with a higher afc than the
+     * first propagator in the next cheaper queue is scheduled in that
+     * queue, and within a queue propagators with a higher afc than
+     * the first propagator are scheduled first. That is, propagators
+     * that are likely to fail are executed earlier.
+     *
+     * Enabling scheduling according to AFC also enables recording
+     * AFC information. The setting is inherited by clones.
+     */
+    void afc_schedule(bool b);
     //@}
   };
 
@@ -2566,32 +2697,65 @@ namespace Gecode {
    */
   forceinline
   SharedHandle::Object::Object(void)
-    : next(NULL), fwd(NULL), use_cnt(0) {}
+    : next(NULL), fwd(NULL), use_cnt(0), frozen(false) {}
   forceinline
   SharedHandle::Object::~Object(void) {
     assert(use_cnt == 0);
   }
 
+  forceinline void*
+  SharedHandle::Group::operator new(size_t s) {
+    return heap.ralloc(s);
+  }
+  forceinline void
+  SharedHandle::Group::operator delete(void* p) {
+    heap.rfree(p);
+  }
+  forceinline
+  SharedHandle::Group::Group(void)
+    : use_cnt(1), n(0), size(0), o(NULL) {}
+  forceinline void
+  SharedHandle::Group::subscribe(void) {
+    (void) Support::Atomic::inc(use_cnt);
+  }
+  forceinline bool
+  SharedHandle::Group::cancel(void) {
+    return Support::Atomic::dec(use_cnt) == 0;
+  }
+
   forceinline SharedHandle::Object*
   SharedHandle::object(void) const {
-    return o;
+    return static_cast<Object*>(Support::funmark(o));
   }
   forceinline void
   SharedHandle::subscribe(void) {
-    if (o != NULL) o->use_cnt++;
+    assert(!Support::marked(o));
+    if (o != NULL) {
+      // Frozen objects might be referenced from several threads
+      if (o->frozen)
+        (void) Support::Atomic::inc(o->use_cnt);
+      else
+        o->use_cnt++;
+    }
   }
   forceinline void
   SharedHandle::cancel(void) {
-    if ((o != NULL) && (--o->use_cnt == 0))
+    if ((o != NULL) && !Support::marked(o) &&
+        (o->frozen ? (Support::Atomic::dec(o->use_cnt) == 0) :
+                     (--o->use_cnt == 0)))
       delete o;
     o=NULL;
   }
   forceinline void
   SharedHandle::object(SharedHandle::Object* n) {
-    if (n != o) {
+    if (n != object()) {
       cancel(); o=n; subscribe();
     }
   }
+  forceinline bool
+  SharedHandle::frozen(void) const {
+    return (o != NULL) && object()->frozen;
+  }
   forceinline
   SharedHandle::SharedHandle(void) : o(NULL) {}
   forceinline
@@ -2599,29 +2763,39 @@ namespace Gecode {
     subscribe();
   }
   forceinline
-  SharedHandle::SharedHandle(const SharedHandle& sh) : o(sh.o) {
+  SharedHandle::SharedHandle(const SharedHandle& sh) : o(sh.object()) {
     subscribe();
   }
   forceinline SharedHandle&
   SharedHandle::operator =(const SharedHandle& sh) {
     if (&sh != this) {
-      cancel(); o=sh.o; subscribe();
+      cancel(); o=sh.object(); subscribe();
     }
     return *this;
   }
   forceinline void
   SharedHandle::update(Space& home, bool share, SharedHandle& sh) {
-    if (sh.o == NULL) {
+    Object* so = sh.object();
+    if (so == NULL) {
       o=NULL; return;
+    } else if (so->frozen) {
+      // If the handle refers to the object, the group must own it
+      if (!Support::marked(sh.o)) {
+        if (home.sg == NULL)
+          home.sg = new Group;
+        home.sg->add(so);
+      }
+      o=static_cast<Object*>(Support::mark(so));
+      return;
     } else if (share) {
-      o=sh.o;
-    } else if (sh.o->fwd != NULL) {
-      o=sh.o->fwd;
+      o=so;
+    } else if (so->fwd != NULL) {
+      o=so->fwd;
     } else {
-      o = sh.o->copy();
-      sh.o->fwd = o;
-      sh.o->next = home.pc.c.shared;
-      home.pc.c.shared = sh.o;
+      o = so->copy();
+      so->fwd = o;
+      so->next = home.pc.c.shared;
+      home.pc.c.shared = so;
     }
     subscribe();
   }
@@ -2759,13 +2933,24 @@ namespace Gecode {
   Space::afc_enabled(void) const {
     return (_wmp_afc & 1U) != 0U;
   }
+  forceinline bool
+  Space::afc_scheduled(void) const {
+    return (_wmp_afc & 2U) != 0U;
+  }
+  forceinline void
+  Space::afc_schedule(bool b) {
+    if (b)
+      _wmp_afc |= 3U;
+    else
+      _wmp_afc &= ~2U;
+  }
   forceinline void
   Space::wmp(unsigned int n) {
-    _wmp_afc = (_wmp_afc & 1U) | (n << 1);
+    _wmp_afc = (_wmp_afc & 3U) | (n << 2);
   }
   forceinline unsigned int
   Space::wmp(void) const {
-    return _wmp_afc >> 1U;
+    return _wmp_afc >> 2U;
   }
 
   forceinline void
@@ -2781,6 +2966,13 @@ namespace Gecode {
     return const_cast<Space*>(this)->_clone(share);
   }
 
+  forceinline void
+  Space::clone(Space** c, unsigned int n, bool share,
+               CloneStatistics&) const {
+    for (unsigned int i=0; i<n; i++)
+      c[i] = const_cast<Space*>(this)->_clone(share);
+  }
+
   forceinline void
   Space::commit(const Choice& c, unsigned int a, CommitStatistics&) {
     _commit(c,a);
@@ -3340,6 +3532,10 @@ namespace Gecode {
    */
   forceinline void
   Space::enqueue(Propagator* p) {
+    pc.p.n_enqueue++;
+    if (afc_scheduled()) {
+      afc_enqueue(p); return;
+    }
     ActorLink::cast(p)->unlink();
     ActorLink* c = &pc.p.queue[p->cost(*this,p->u.med).ac];
     c->tail(ActorLink::cast(p));
@@ -3859,6 +4055,7 @@ namespace Gecode {
   forceinline void
   StatusStatistics::reset(void) {
     propagate = 0;
+    enqueue = 0;
     wmp = false;
   }
   forceinline
@@ -3868,6 +4065,7 @@ namespace Gecode {
   forceinline StatusStatistics&
   StatusStatistics::operator +=(const StatusStatistics& s) { 
     propagate += s.propagate;
+    enqueue += s.enqueue;
     wmp |= s.wmp;
     return *this;
   }
@@ -47,11 +47,31 @@ namespace Gecode {
   namespace MemoryConfig {
     /**
      * \brief How many heap chunks should be cached at most
+     *
+     * This is the default, it can be changed at runtime through
+     * Gecode::HeapChunkPool.
      */
     const unsigned int n_hc_cache = 4*4;
+    /**
+     * \brief How many heap chunks are exchanged at once with the global pool
+     *
+     * This is the default, it can be changed at runtime through
+     * Gecode::HeapChunkPool.
+     */
+    const unsigned int n_hc_batch = 4;
+    /**
+     * \brief How many heap chunks are kept at most in the global pool
+     *
+     * This is the default, it can be changed at runtime through
+     * Gecode::HeapChunkPool.
+     */
+    const unsigned int n_hc_pool = 16*16;
 
     /**
      * \brief Minimal size of a heap chunk requested from the OS
+     *
+     * This is the default, it can be changed at runtime through
+     * Gecode::HeapChunkPool.
      */
     const size_t hcsz_min =  1024;
     /**
@@ -60,8 +80,20 @@ namespace Gecode {
      * Maximal is not strictly true, if a contiguous memory chunk is
      * requested that exceeds \a hcsz_max, a chunk will be allocated
      * that fits that request.
+     *
+     * This is the default, it can be changed at runtime through
+     * Gecode::HeapChunkPool.
      */
     const size_t hcsz_max = 32 * 1024;
+    /**
+     * \brief Size of a huge page
+     *
+     * If enabled through Gecode::HeapChunkPool, heap chunks of at
+     * least this size are allocated as multiples of this size, are
+     * aligned accordingly, and the operating system is advised to
+     * back them by huge pages.
+     */
+    const size_t hpsz = 2 * 1024 * 1024;
     /**
      * \brief Increment ratio for chunk size
      *
@@ -39,6 +39,99 @@
 
 namespace Gecode {
 
+  /*
+   * Global pool of heap chunks
+   *
+   */
+
+  HeapChunkPool::HeapChunkPool(void)
+    : n_hc(0), hc(NULL),
+      _hcsz_min(MemoryConfig::hcsz_min), _hcsz_max(MemoryConfig::hcsz_max),
+      _n_hc_cache(MemoryConfig::n_hc_cache),
+      _n_hc_batch(MemoryConfig::n_hc_batch),
+      _n_hc_pool(MemoryConfig::n_hc_pool),
+      _huge_pages(false) {}
+
+  HeapChunk*
+  HeapChunkPool::alloc(size_t s) {
+    HeapChunk* c;
+    if (_huge_pages && (s >= MemoryConfig::hpsz)) {
+      s = ((s + MemoryConfig::hpsz - 1) / MemoryConfig::hpsz) * 
+        MemoryConfig::hpsz;
+      c = static_cast<HeapChunk*>(Gecode::heap.hpalloc(s,MemoryConfig::hpsz));
+    } else {
+      c = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
+    }
+    c->size = s;
+    return c;
+  }
+
+  HeapChunk*
+  HeapChunkPool::get(size_t l, unsigned int& n) {
+    HeapChunk* f = NULL;
+    n = 0;
+    m.acquire();
+    HeapChunk* p = NULL;
+    HeapChunk* c = hc;
+    while ((c != NULL) && (n < _n_hc_batch)) {
+      HeapChunk* d = static_cast<HeapChunk*>(c->next);
+      if (c->size >= l) {
+        // Move chunk from the pool to the result
+        if (p == NULL)
+          hc = d;
+        else
+          p->next = d;
+        c->next = f; f = c; n++;
+      } else {
+        p = c;
+      }
+      c = d;
+    }
+    n_hc -= n;
+    m.release();
+    return f;
+  }
+
+  void
+  HeapChunkPool::put(HeapChunk* f, HeapChunk* l, unsigned int n) {
+    m.acquire();
+    if (n_hc + n <= _n_hc_pool) {
+      l->next = hc; hc = f; n_hc += n;
+      f = NULL;
+    }
+    m.release();
+    // Release the chunks that do not fit into the pool
+    while (f != NULL) {
+      HeapChunk* c = f;
+      f = (c == l) ? NULL : static_cast<HeapChunk*>(c->next);
+      Gecode::heap.rfree(c);
+    }
+  }
+
+  void
+  HeapChunkPool::flush(void) {
+    m.acquire();
+    HeapChunk* f = hc;
+    hc = NULL; n_hc = 0;
+    m.release();
+    while (f != NULL) {
+      HeapChunk* c = f;
+      f = static_cast<HeapChunk*>(c->next);
+      Gecode::heap.rfree(c);
+    }
+  }
+
+  HeapChunkPool::~HeapChunkPool(void) {
+    flush();
+  }
+
+  HeapChunkPool hcpool;
+
+  /*
+   * Memory manager
+   *
+   */
+
   void
   MemoryManager::alloc_refill(SharedMemory* sm, size_t sz) {
     // Try to reuse the not used memory
@@ -60,6 +60,99 @@ namespace Gecode {
     double area[1];
   };
 
+  /**
+   * \brief Global pool of heap chunks
+   *
+   * Spaces that do not share memory with each other (for example,
+   * the spaces explored by different threads of a parallel search
+   * engine) each cache some heap chunks. When a cache overflows, a
+   * batch of chunks is returned to this pool and an empty cache is
+   * refilled by a batch of chunks from this pool. Hence, spaces
+   * obtained by non-shared cloning need not request all their chunks
+   * from the operating system. Access to the pool is synchronized but
+   * only happens once per batch.
+   *
+   * The pool also defines the parameters for heap chunks. They are
+   * initialized from Gecode::MemoryConfig and can be changed at any
+   * time, changes take effect for chunks requested later.
+   *
+   * \ingroup FuncMemSpace
+   */
+  class HeapChunkPool {
+  private:
+    /// Mutex for synchronizing access to the chunks
+    Support::FastMutex m;
+    /// Number of chunks in the pool
+    unsigned int n_hc;
+    /// The chunks in the pool
+    HeapChunk* hc;
+    /// Minimal size of a heap chunk
+    size_t _hcsz_min;
+    /// Maximal size of a heap chunk
+    size_t _hcsz_max;
+    /// How many heap chunks are cached at most by a space
+    unsigned int _n_hc_cache;
+    /// How many heap chunks are exchanged at once with the pool
+    unsigned int _n_hc_batch;
+    /// How many heap chunks are kept at most in the pool
+    unsigned int _n_hc_pool;
+    /// Whether to back large heap chunks by huge pages
+    bool _huge_pages;
+  public:
+    /// Initialize with parameters from Gecode::MemoryConfig
+    HeapChunkPool(void);
+    /// \name Parameters
+    //@{
+    /// Return minimal size of a heap chunk
+    size_t hcsz_min(void) const;
+    /// Set minimal size of a heap chunk to \a s (maximal size is increased if needed)
+    void hcsz_min(size_t s);
+    /// Return maximal size of a heap chunk
+    size_t hcsz_max(void) const;
+    /// Set maximal size of a heap chunk to \a s (minimal size is decreased if needed)
+    void hcsz_max(size_t s);
+    /// Return how many heap chunks are cached at most by a space
+    unsigned int n_hc_cache(void) const;
+    /// Set how many heap chunks are cached at most by a space to \a n
+    void n_hc_cache(unsigned int n);
+    /// Return how many heap chunks are exchanged at once with the pool
+    unsigned int n_hc_batch(void) const;
+    /// Set how many heap chunks are exchanged at once with the pool to \a n
+    void n_hc_batch(unsigned int n);
+    /// Return how many heap chunks are kept at most in the pool
+    unsigned int n_hc_pool(void) const;
+    /// Set how many heap chunks are kept at most in the pool to \a n
+    void n_hc_pool(unsigned int n);
+    /// Return whether heap chunks are backed by huge pages
+    bool huge_pages(void) const;
+    /**
+     * \brief Set whether heap chunks are backed by huge pages
+     *
+     * Only chunks of at least MemoryConfig::hpsz bytes are backed by
+     * huge pages, which requires to increase the maximal size of heap
+     * chunks accordingly. Huge pages are only supported on Linux,
+     * otherwise the setting has no effect.
+     */
+    void huge_pages(bool b);
+    //@}
+    /// \name Chunk management
+    //@{
+    /// Allocate new heap chunk of at least size \a s from the operating system
+    GECODE_KERNEL_EXPORT HeapChunk* alloc(size_t s);
+    /// Remove and return at most a batch of heap chunks of at least size \a l, \a n is set to their number
+    GECODE_KERNEL_EXPORT HeapChunk* get(size_t l, unsigned int& n);
+    /// Add \a n heap chunks linked from \a f to \a l
+    GECODE_KERNEL_EXPORT void put(HeapChunk* f, HeapChunk* l, unsigned int n);
+    /// Return all heap chunks to the operating system
+    GECODE_KERNEL_EXPORT void flush(void);
+    //@}
+    /// Destructor
+    GECODE_KERNEL_EXPORT ~HeapChunkPool(void);
+  };
+
+  /// The global pool of heap chunks
+  extern GECODE_KERNEL_EXPORT HeapChunkPool hcpool;
+
   class Region;
 
   /// Shared object for several memory areas
@@ -193,6 +286,65 @@ namespace Gecode {
   };
 
 
+  /*
+   * Global pool of heap chunks
+   *
+   */
+
+  forceinline size_t
+  HeapChunkPool::hcsz_min(void) const {
+    return _hcsz_min;
+  }
+  forceinline void
+  HeapChunkPool::hcsz_min(size_t s) {
+    _hcsz_min = s;
+    if (_hcsz_max < s)
+      _hcsz_max = s;
+  }
+  forceinline size_t
+  HeapChunkPool::hcsz_max(void) const {
+    return _hcsz_max;
+  }
+  forceinline void
+  HeapChunkPool::hcsz_max(size_t s) {
+    _hcsz_max = s;
+    if (_hcsz_min > s)
+      _hcsz_min = s;
+  }
+  forceinline unsigned int
+  HeapChunkPool::n_hc_cache(void) const {
+    return _n_hc_cache;
+  }
+  forceinline void
+  HeapChunkPool::n_hc_cache(unsigned int n) {
+    _n_hc_cache = n;
+  }
+  forceinline unsigned int
+  HeapChunkPool::n_hc_batch(void) const {
+    return _n_hc_batch;
+  }
+  forceinline void
+  HeapChunkPool::n_hc_batch(unsigned int n) {
+    _n_hc_batch = std::max(n,1U);
+  }
+  forceinline unsigned int
+  HeapChunkPool::n_hc_pool(void) const {
+    return _n_hc_pool;
+  }
+  forceinline void
+  HeapChunkPool::n_hc_pool(unsigned int n) {
+    _n_hc_pool = n;
+  }
+  forceinline bool
+  HeapChunkPool::huge_pages(void) const {
+    return _huge_pages;
+  }
+  forceinline void
+  HeapChunkPool::huge_pages(bool b) {
+    _huge_pages = b;
+  }
+
+
   /*
    * Shared memory area
    *
@@ -224,7 +376,13 @@ namespace Gecode {
   }
   forceinline
   SharedMemory::~SharedMemory(void) {
-    flush();
+    // Keep the cached heap chunks for other spaces
+    if (heap.hc != NULL) {
+      HeapChunk* l = heap.hc;
+      while (l->next != NULL)
+        l = static_cast<HeapChunk*>(l->next);
+      hcpool.put(heap.hc,l,heap.n_hc);
+    }
   }
   forceinline SharedMemory*
   SharedMemory::copy(bool share) {
@@ -258,23 +416,31 @@ namespace Gecode {
     }
     if (heap.hc == NULL) {
       assert(heap.n_hc == 0);
-      HeapChunk* hc = static_cast<HeapChunk*>(Gecode::heap.ralloc(s));
-      hc->size = s;
-      return hc;
-    } else {
-      heap.n_hc--;
-      HeapChunk* hc = heap.hc;
-      heap.hc = static_cast<HeapChunk*>(hc->next);
-      return hc;
+      // Try to refill the cache from the global pool
+      unsigned int n;
+      heap.hc = hcpool.get(l,n);
+      if (heap.hc == NULL)
+        return hcpool.alloc(s);
+      heap.n_hc = n;
     }
+    heap.n_hc--;
+    HeapChunk* hc = heap.hc;
+    heap.hc = static_cast<HeapChunk*>(hc->next);
+    return hc;
   }
   forceinline void
   SharedMemory::heap_free(HeapChunk* hc) {
-    if (heap.n_hc == MemoryConfig::n_hc_cache) {
-      Gecode::heap.rfree(hc);
-    } else {
-      heap.n_hc++;
-      hc->next = heap.hc; heap.hc = hc;
+    hc->next = heap.hc; heap.hc = hc;
+    if (++heap.n_hc > hcpool.n_hc_cache()) {
+      // Return a batch of chunks to the global pool
+      HeapChunk* l = hc;
+      unsigned int n = 1;
+      while ((n < hcpool.n_hc_batch()) && (l->next != NULL)) {
+        l = static_cast<HeapChunk*>(l->next); n++;
+      }
+      heap.hc = static_cast<HeapChunk*>(l->next);
+      heap.n_hc -= n;
+      hcpool.put(hc,l,n);
     }
   }
 
@@ -346,7 +512,7 @@ namespace Gecode {
     // Adjust current heap chunk size
     if (((requested > MemoryConfig::hcsz_inc_ratio*cur_hcsz) ||
          (sz > cur_hcsz)) &&
-        (cur_hcsz < MemoryConfig::hcsz_max) &&
+        (cur_hcsz < hcpool.hcsz_max()) &&
         !first) {
       cur_hcsz <<= 1;
     }
@@ -376,7 +542,7 @@ namespace Gecode {
 
   forceinline
   MemoryManager::MemoryManager(SharedMemory* sm)
-    : cur_hcsz(MemoryConfig::hcsz_min), requested(0), slack(NULL) {
+    : cur_hcsz(hcpool.hcsz_min()), requested(0), slack(NULL) {
     alloc_fill(sm,cur_hcsz,true);
     for (size_t i = MemoryConfig::fl_size_max-MemoryConfig::fl_size_min+1;
          i--; )
@@ -389,7 +555,7 @@ namespace Gecode {
     : cur_hcsz(mm.cur_hcsz), requested(0), slack(NULL) {
     MemoryConfig::align(s_sub);
     if ((mm.requested < MemoryConfig::hcsz_dec_ratio*mm.cur_hcsz) &&
-        (cur_hcsz > MemoryConfig::hcsz_min) &&
+        (cur_hcsz > hcpool.hcsz_min()) &&
         (s_sub*2 < cur_hcsz))
       cur_hcsz >>= 1;
     alloc_fill(sm,cur_hcsz+s_sub,true);
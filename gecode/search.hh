@@ -83,6 +83,29 @@ namespace Gecode { namespace Search {
   /// %Meta search engine implementations
   namespace Meta {}
 
+  /**
+   * \brief How idle workers of parallel engines find work
+   *
+   * \ingroup TaskModelSearch
+   */
+  enum StealMode {
+    /**
+     * \brief Steal from the path of a busy worker
+     *
+     * An idle worker locks one worker after the other and steals
+     * the shallowest open alternative from its path.
+     */
+    SM_PATH,
+    /**
+     * \brief Steal from work-stealing deques
+     *
+     * Busy workers donate open alternatives from their path to their
+     * own lock-free deque. Idle workers steal from the deques of
+     * randomly chosen workers without taking any lock.
+     */
+    SM_DEQUE
+  };
+
   /**
    * \brief %Search configuration
    *
@@ -102,6 +125,20 @@ namespace Gecode { namespace Search {
     const unsigned int steal_limit = 3;
     /// Initial delay in milliseconds for all but first worker thread
     const unsigned int initial_delay = 5;
+    /// How idle workers find work
+    const StealMode steal = SM_PATH;
+    /// Maximal number of donated subtrees per worker (must be a power of two)
+    const unsigned int deque_size = 4;
+    /// Number of donated subtrees a worker keeps available for stealing
+    const unsigned int deque_limit = 2;
+
+    /// Number of assets for portfolio search (0 means one asset per thread)
+    const unsigned int assets = 0;
+
+    /// Initial relaxation rate for large neighbourhood search
+    const double relax = 0.3;
+    /// Adaptation factor for the relaxation rate
+    const double relax_adapt = 1.1;
 
     /// Depth limit for no-good generation during search
     const unsigned int nogoods_limit = 128;
@@ -122,6 +159,12 @@ namespace Gecode { namespace Search {
     /// Initialize with location \a l
     UninitializedCutoff(const char* l);
   };
+  /// %Exception: No assets for portfolio-based search
+  class GECODE_VTABLE_EXPORT NoAssets : public Exception {
+  public:
+    /// Initialize with location \a l
+    NoAssets(const char* l);
+  };
   //@}
 }}
 
@@ -198,6 +241,19 @@ namespace Gecode { namespace Search {
      * is zero, \f$m\f$ threads are chosen. If \f$0<n<1\f$,
      * \f$n \times m\f$ threads are chosen. If \f$-1 <n<0\f$, 
      * \f$(1+n)\times m\f$ threads are chosen.
+     *
+     * How idle workers of parallel engines find work is controlled by
+     * \a steal (see StealMode).
+     *
+     * The number of assets used by portfolio-based search (see PBS) is
+     * controlled by \a assets. If \a assets is zero, the portfolio
+     * uses one asset per thread.
+     *
+     * Large neighbourhood search (see LNS) starts with relaxation rate
+     * \a relax. Whenever a neighbourhood has been explored without
+     * improvement, the rate is multiplied by \a relax_adapt; whenever
+     * the exploration of a neighbourhood hits the cutoff, the rate is
+     * divided by \a relax_adapt.
      * 
      * \ingroup TaskModelSearch
      */
@@ -213,6 +269,14 @@ namespace Gecode { namespace Search {
       unsigned int a_d;
       /// Depth limit for extraction of no-goods
       unsigned int nogoods_limit;
+      /// How idle workers of parallel engines find work
+      StealMode steal;
+      /// Number of assets for portfolio-based search
+      unsigned int assets;
+      /// Initial relaxation rate for large neighbourhood search
+      double relax;
+      /// Adaptation factor for the relaxation rate
+      double relax_adapt;
       /// Stop object for stopping search
       Stop* stop;
       /// Cutoff for restart-based search
@@ -235,11 +299,18 @@ namespace Gecode {
   template<template<class> class E, class T>
   class RBS;
 
+  template<template<class> class E, class T>
+  class PBS;
+
+  template<template<class> class E, class T>
+  class LNS;
+
 }
 
 namespace Gecode { namespace Search { namespace Meta {
 
   class RBS;
+  class LNS;
 
 }}}
 
@@ -348,7 +419,9 @@ namespace Gecode { namespace Search {
    */
   class GECODE_SEARCH_EXPORT MetaStop : public Stop {
     template<template<class>class,class> friend class ::Gecode::RBS;
+    template<template<class>class,class> friend class ::Gecode::LNS;
     friend class ::Gecode::Search::Meta::RBS;
+    friend class ::Gecode::Search::Meta::LNS;
   private:
     /// The failure stop object for the engine
     FailStop* e_stop;
@@ -449,6 +522,8 @@ namespace Gecode { namespace Search {
     virtual void reset(Space* s) = 0;
     /// Return no-goods
     virtual NoGoods& nogoods(void) = 0;
+    /// Constrain future solutions to be better than \a b (default: do nothing)
+    virtual void constrain(const Space&) {}
     /// Destructor
     virtual ~Engine(void) {}
   };
@@ -462,6 +537,8 @@ namespace Gecode {
    */
   class EngineBase {
     template<template<class>class,class> friend class ::Gecode::RBS;
+    template<template<class>class,class> friend class ::Gecode::PBS;
+    template<template<class>class,class> friend class ::Gecode::LNS;
   protected:
     /// The actual search engine
     Search::Engine* e;
@@ -613,6 +690,124 @@ namespace Gecode {
 
 #include <gecode/search/rbs.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Meta-engine performing portfolio-based search
+   *
+   * The engine runs a portfolio of assets in parallel, each asset
+   * in its own thread and on its own clone of the space \a s. An
+   * asset is either an engine of type \a E or, if its options
+   * provide a cutoff, a restart-based engine using \a E. As soon as
+   * an asset finds a solution, all other assets are stopped.
+   *
+   * If \a E is BAB, only solutions better than all previous solutions
+   * are returned and each better solution is shared with all assets.
+   * Otherwise, all further solutions are found by the asset that
+   * found the first solution.
+   *
+   * The class \a T can implement a member function
+   * \code virtual void asset(unsigned int i) \endcode
+   * which the engine executes on the space for asset \a i before
+   * search starts (for example, to diversify the branchings of the
+   * assets).
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<template<class> class E, class T>
+  class PBS : public EngineBase {
+  protected:
+    /// Build \a n assets with options \a ao for space \a s and options \a m_opt
+    void build(T* s, const Search::Options* ao, unsigned int n,
+               const Search::Options& m_opt);
+  public:
+    /**
+     * \brief Initialize engine for space \a s and options \a o
+     *
+     * The engine uses \a o.assets assets (or one asset per thread if
+     * \a o.assets is zero), each asset using a single thread. If a
+     * cutoff is provided by \a o, the first asset performs
+     * restart-based search.
+     */
+    PBS(T* s, const Search::Options& o);
+    /// Initialize engine for space \a s with \a n assets with options \a ao and options \a o
+    PBS(T* s, const Search::Options ao[], unsigned int n,
+        const Search::Options& o=Search::Options::def);
+    /// Return next solution (NULL, if non exists or search has been stopped)
+    T* next(void);
+    /// Return statistics
+    Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    bool stopped(void) const;
+  };
+
+  /**
+   * \brief Perform portfolio-based search
+   *
+   * The portfolio consists of \a o.assets assets of type \a E.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<template<class> class E, class T>
+  T* pbs(T* s, const Search::Options& o);
+
+}
+
+#include <gecode/search/pbs.hpp>
+
+namespace Gecode {
+
+  /**
+   * \brief Meta-engine performing large neighbourhood search
+   *
+   * After the engine \a E has found a first solution, the engine
+   * explores neighbourhoods of the best solution found so far. Each
+   * neighbourhood is explored by \a E with a failure limit taken from
+   * the Cutoff sequence supplied in the options \a o. The search for
+   * the first solution is not limited.
+   *
+   * The class \a T must implement member functions
+   * \code virtual void constrain(const Space& b) \endcode
+   * and
+   * \code virtual bool relax(unsigned long int i, const Space& s, double r) \endcode
+   * The engine executes \c relax on the space for each neighbourhood
+   * with the best solution \a s found so far and the current
+   * relaxation rate \a r. The relaxation rate adapts to how
+   * neighbourhoods are explored (see Search::Options). Search is
+   * complete when a neighbourhood for which \c relax did not fix any
+   * variable has been explored.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<template<class> class E, class T>
+  class LNS : public EngineBase {
+  public:
+    /// Initialize engine for space \a s and options \a o
+    LNS(T* s, const Search::Options& o);
+    /// Return next better solution (NULL, if non exists or search has been stopped)
+    T* next(void);
+    /// Return statistics
+    Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    bool stopped(void) const;
+  };
+
+  /**
+   * \brief Perform large neighbourhood search
+   *
+   * The engine uses the Cutoff sequence supplied in the options \a o
+   * to limit the exploration of each neighbourhood by an engine of
+   * type \a E.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<template<class> class E, class T>
+  T* lns(T* s, const Search::Options& o);
+
+}
+
+#include <gecode/search/lns.hpp>
+
 #endif
 
 // STATISTICS: search-other
@@ -41,6 +41,10 @@ namespace Gecode { namespace Search {
   UninitializedCutoff::UninitializedCutoff(const char* l)
     : Exception(l,"Cutoff for restart-based search is missing") {}
 
+  inline
+  NoAssets::NoAssets(const char* l)
+    : Exception(l,"Portfolio-based search requires at least one asset") {}
+
 }}
 
 // STATISTICS: search-other
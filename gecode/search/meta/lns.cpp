@@ -0,0 +1,134 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/search/meta/lns.hh>
+
+namespace Gecode { namespace Search { namespace Meta {
+
+  bool
+  LNS::neighbourhood(unsigned long int i) {
+    if (master->status(stop->m_stat) == SS_FAILED)
+      return false;
+    Space* slave = master;
+    master = master->clone(shared);
+    relaxed = (inc != NULL) && slave->relax(i,*inc,r);
+    e->reset(slave);
+    return true;
+  }
+
+  Space*
+  LNS::next(void) {
+    while (master != NULL) {
+      Space* n = e->next();
+      if (n != NULL) {
+        // Future solutions must be better than the new incumbent
+        stop->m_stat.restart++;
+        stop->limit(e->statistics(),(*co)());
+        master->constrain(*n);
+        delete inc;
+        inc = n->clone(shared);
+        if (!neighbourhood(stop->m_stat.restart)) {
+          delete master;
+          master = NULL;
+          e->reset(NULL);
+        }
+        return n;
+      } else if (e->stopped() && stop->enginestopped()) {
+        // Fail limit reached: the neighbourhood is too large
+        r /= a;
+        stop->limit(e->statistics(),(*co)());
+      } else if (!e->stopped() && relaxed) {
+        // Neighbourhood exhausted: the neighbourhood is too small
+        r *= a;
+        if (r > 1.0)
+          r = 1.0;
+        stop->m_stat.restart++;
+        stop->limit(e->statistics(),(*co)());
+      } else {
+        // Search is complete or has been stopped
+        return NULL;
+      }
+      if (!neighbourhood(stop->m_stat.restart)) {
+        delete master;
+        master = NULL;
+        e->reset(NULL);
+      }
+    }
+    return NULL;
+  }
+  
+  Search::Statistics
+  LNS::statistics(void) const {
+    return stop->metastatistics()+e->statistics();
+  }
+  
+  bool
+  LNS::stopped(void) const {
+    return e->stopped(); 
+  }
+  
+  void
+  LNS::reset(Space*) { 
+  }
+  
+  NoGoods LNS::eng;
+
+  NoGoods&
+  LNS::nogoods(void) {
+    return eng;
+  }
+
+  void
+  LNS::constrain(const Space& b) {
+    if (master != NULL)
+      master->constrain(b);
+    e->constrain(b);
+    delete inc;
+    inc = b.clone(false);
+  }
+
+  LNS::~LNS(void) {
+    delete e;
+    delete master;
+    delete inc;
+    delete co;
+  }
+
+}}}
+
+// STATISTICS: search-other
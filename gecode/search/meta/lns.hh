@@ -0,0 +1,106 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef __GECODE_SEARCH_META_LNS_HH__
+#define __GECODE_SEARCH_META_LNS_HH__
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search { namespace Meta {
+
+  /// Engine for large neighbourhood search
+  class LNS : public Engine {
+  private:
+    /// The actual engine
+    Engine* e;
+    /// The master space to create neighbourhoods from
+    Space* master;
+    /// The incumbent solution (NULL if there is none yet)
+    Space* inc;
+    /// The cutoff object
+    Cutoff* co;
+    /// The stop control object
+    MetaStop* stop;
+    /// Whether the slave can be shared with the master
+    bool shared;
+    /// Current relaxation rate
+    double r;
+    /// Factor by which the relaxation rate is adapted
+    double a;
+    /// Whether the current neighbourhood has been relaxed
+    bool relaxed;
+    /// Empty no-goods
+    GECODE_SEARCH_EXPORT
+    static NoGoods eng;
+    /// Explore next neighbourhood \a i (return false if master failed)
+    bool neighbourhood(unsigned long int i);
+  public:
+    /// Constructor
+    LNS(Space* s, Cutoff* co0, MetaStop* stop0,
+        Engine* e0, const Options& o);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Reset engine to restart at space \a s
+    virtual void reset(Space* s);
+    /// Return no-goods
+    virtual NoGoods& nogoods(void);
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Destructor
+    virtual ~LNS(void);
+  };
+
+  forceinline
+  LNS::LNS(Space* s, Cutoff* co0, MetaStop* stop0,
+           Engine* e0, const Options& opt)
+    : e(e0), master(s), inc(NULL), co(co0), stop(stop0),
+      shared(opt.threads == 1), r(opt.relax), a(opt.relax_adapt),
+      relaxed(false) {
+    // Without an incumbent, the engine searches without fail limit
+    stop->limit(Statistics(),~0UL);
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-other
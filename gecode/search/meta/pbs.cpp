@@ -0,0 +1,179 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/search/meta/pbs.hh>
+
+namespace Gecode { namespace Search { namespace Meta {
+
+  bool
+  PortfolioStop::stop(const Statistics& s, const Options& o) {
+    return *sa || ((so != NULL) && so->stop(s,o));
+  }
+
+
+  void
+  PBS::Runner::run(void) {
+    pbs.run(a);
+  }
+
+  void
+  PBS::run(unsigned int a) {
+    Space* s = slaves[a]->next();
+    if (s != NULL) {
+      // Make sure the solution shares no data with the asset
+      Space* c = s->clone(false);
+      delete s;
+      s = c;
+    }
+    m.acquire();
+    if (s != NULL) {
+      if (best && (b != NULL)) {
+        // Only accept solutions better than the best so far
+        s->constrain(*b);
+        if (s->status() == SS_FAILED) {
+          delete s; s = NULL;
+        }
+      } else if (!best && (winner < n_slaves)) {
+        // Another asset has been faster
+        delete s; s = NULL;
+      }
+      if (s != NULL) {
+        if (best) {
+          delete b;
+          b = s->clone(false);
+          improved = true;
+        }
+        winner = a;
+        solutions.push(s);
+        stop_all = true;
+      }
+    } else if (!slaves[a]->stopped()) {
+      // The asset has explored its entire search tree
+      complete = true;
+      stop_all = true;
+    }
+    bool last = (--n_active == 0);
+    m.release();
+    if (last)
+      e_done.signal();
+  }
+
+  Space*
+  PBS::next(void) {
+    _stopped = false;
+    if (!solutions.empty())
+      return solutions.pop();
+    if (complete)
+      return NULL;
+    stop_all = false;
+    if (!best && (winner < n_slaves))
+      // Only the asset that found the first solution continues
+      return slaves[winner]->next();
+    if (improved) {
+      // Share the best solution with all assets that do not know it
+      for (unsigned int i=0; i<n_slaves; i++)
+        if (i != winner)
+          slaves[i]->constrain(*b);
+      improved = false;
+    }
+    n_active = n_slaves;
+#ifdef GECODE_HAS_THREADS
+    for (unsigned int i=0; i<n_slaves; i++)
+      Support::Thread::run(new Runner(*this,i));
+    e_done.wait();
+#else
+    for (unsigned int i=0; i<n_slaves; i++)
+      run(i);
+#endif
+    if (!solutions.empty())
+      return solutions.pop();
+    _stopped = !complete;
+    return NULL;
+  }
+
+  Search::Statistics
+  PBS::statistics(void) const {
+    Statistics s;
+    for (unsigned int i=0; i<n_slaves; i++)
+      s += slaves[i]->statistics();
+    return s;
+  }
+
+  bool
+  PBS::stopped(void) const {
+    if (!best && (winner < n_slaves))
+      return slaves[winner]->stopped();
+    return _stopped;
+  }
+
+  void
+  PBS::reset(Space*) {
+  }
+
+  NoGoods PBS::eng;
+
+  NoGoods&
+  PBS::nogoods(void) {
+    return eng;
+  }
+
+  void
+  PBS::constrain(const Space& s) {
+    if (!best)
+      return;
+    delete b;
+    b = s.clone(false);
+    improved = true;
+    winner = n_slaves;
+  }
+
+  PBS::~PBS(void) {
+    while (!solutions.empty())
+      delete solutions.pop();
+    delete b;
+    for (unsigned int i=0; i<n_slaves; i++) {
+      delete slaves[i];
+      delete stops[i];
+    }
+    heap.free<Engine*>(slaves,n_slaves);
+    heap.free<Stop*>(stops,n_slaves);
+  }
+
+}}}
+
+// STATISTICS: search-other
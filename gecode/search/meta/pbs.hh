@@ -0,0 +1,155 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef __GECODE_SEARCH_META_PBS_HH__
+#define __GECODE_SEARCH_META_PBS_HH__
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search { namespace Meta {
+
+  /// %Stop-object for an asset of a portfolio
+  class GECODE_SEARCH_EXPORT PortfolioStop : public Stop {
+  private:
+    /// The stop object for the portfolio
+    Stop* so;
+    /// Whether all assets of the portfolio must be stopped
+    volatile bool* sa;
+  public:
+    /// Stop the asset if indicated by the stop object \a so0
+    PortfolioStop(Stop* so0);
+    /// Share flag \a sa0 that stops all assets
+    void share(volatile bool* sa0);
+    /// Return true if asset must be stopped
+    virtual bool stop(const Statistics& s, const Options& o);
+  };
+
+  /// Engine for portfolio-based search
+  class GECODE_SEARCH_EXPORT PBS : public Engine {
+  protected:
+    /// %Runnable object executing the search of an asset
+    class Runner : public Support::Runnable {
+    protected:
+      /// The portfolio engine
+      PBS& pbs;
+      /// The asset to run
+      unsigned int a;
+    public:
+      /// Initialize for portfolio \a p and asset \a a0
+      Runner(PBS& p, unsigned int a0);
+      /// Search for the next solution of the asset
+      virtual void run(void);
+    };
+    /// The engines for the assets
+    Engine** slaves;
+    /// The stop objects for the assets
+    Stop** stops;
+    /// Number of assets
+    unsigned int n_slaves;
+    /// Whether the assets perform best solution search
+    bool best;
+    /// Mutex for access to the following data
+    Support::Mutex m;
+    /// Whether all assets must be stopped
+    volatile bool stop_all;
+    /// Number of assets still running in the current round
+    unsigned int n_active;
+    /// Event signalling that all assets of the current round are done
+    Support::Event e_done;
+    /// Queue of solutions found in the current round
+    Support::DynamicQueue<Space*,Heap> solutions;
+    /// Best solution so far (best solution search only)
+    Space* b;
+    /// Asset that found the last solution (\a n_slaves if none)
+    unsigned int winner;
+    /// Whether a better solution must be shared with the assets
+    bool improved;
+    /// Whether search has been completed by some asset
+    bool complete;
+    /// Whether search has been stopped
+    bool _stopped;
+    /// Empty no-goods
+    static NoGoods eng;
+    /// Search for next solution by asset \a a
+    void run(unsigned int a);
+  public:
+    /// Initialize for \a n assets \a s with stop objects \a so
+    PBS(Engine** s, Stop** so, unsigned int n, bool best);
+    /// Return next solution (NULL, if none exists or search has been stopped)
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Search::Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Reset engine to restart at space \a s
+    virtual void reset(Space* s);
+    /// Return no-goods
+    virtual NoGoods& nogoods(void);
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Destructor
+    virtual ~PBS(void);
+  };
+
+
+  forceinline
+  PortfolioStop::PortfolioStop(Stop* so0) : so(so0), sa(NULL) {}
+
+  forceinline void
+  PortfolioStop::share(volatile bool* sa0) {
+    sa = sa0;
+  }
+
+
+  forceinline
+  PBS::Runner::Runner(PBS& p, unsigned int a0) : pbs(p), a(a0) {}
+
+  forceinline
+  PBS::PBS(Engine** s, Stop** so, unsigned int n, bool b0)
+    : slaves(s), stops(so), n_slaves(n), best(b0),
+      stop_all(false), n_active(0), solutions(heap), b(NULL),
+      winner(n), improved(false), complete(false), _stopped(false) {
+    for (unsigned int i=0; i<n_slaves; i++)
+      static_cast<PortfolioStop*>(stops[i])->share(&stop_all);
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-other
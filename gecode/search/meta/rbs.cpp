@@ -111,6 +111,13 @@ namespace Gecode { namespace Search { namespace Meta {
   RBS::nogoods(void) {
     return eng;
   }
+
+  void
+  RBS::constrain(const Space& b) {
+    if (master != NULL)
+      master->constrain(b);
+    e->constrain(b);
+  }
   
   RBS::~RBS(void) {
     // Deleting e also deletes stop
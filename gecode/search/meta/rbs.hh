@@ -73,6 +73,8 @@ namespace Gecode { namespace Search { namespace Meta {
     virtual void reset(Space* s);
     /// Return no-goods
     virtual NoGoods& nogoods(void);
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
     /// Destructor
     virtual ~RBS(void);
   };
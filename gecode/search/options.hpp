@@ -42,7 +42,9 @@ namespace Gecode { namespace Search {
     : clone(Config::clone), 
       threads(Config::threads), 
       c_d(Config::c_d), a_d(Config::a_d), 
-      nogoods_limit(0),
+      nogoods_limit(0), steal(Config::steal),
+      assets(Config::assets),
+      relax(Config::relax), relax_adapt(Config::relax_adapt),
       stop(NULL), cutoff(NULL) {}
 
 }}
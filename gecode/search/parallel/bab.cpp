@@ -88,6 +88,7 @@ namespace Gecode { namespace Search { namespace Parallel {
       case C_WORK:
         // Perform exploration work
         {
+          unsigned long int r_d = 0ul;
           m.acquire();
           if (idle) {
             m.release();
@@ -138,6 +139,8 @@ namespace Gecode { namespace Search { namespace Parallel {
                   const Choice* ch = path.push(*this,cur,c);
                   cur->commit(*ch,0);
                   m.release();
+                  if (engine().opt().steal == SM_DEQUE)
+                    donate();
                 }
                 break;
               default:
@@ -147,6 +150,18 @@ namespace Gecode { namespace Search { namespace Parallel {
           } else if (path.next()) {
             cur = path.recompute(d,engine().opt().a_d,*this,best,mark);
             m.release();
+          } else if (Space* s = deque.take(r_d)) {
+            // Continue with a subtree that has been donated but not stolen
+            path.ngdl(0);
+            d = 0;
+            cur = s;
+            mark = 0;
+            if (best != NULL)
+              cur->constrain(*best);
+            Search::Worker::reset(r_d);
+            m.release();
+            // Give back the busy count of the donated subtree
+            engine().idle();
           } else {
             idle = true;
             path.ngdl(0);
@@ -214,6 +229,31 @@ namespace Gecode { namespace Search { namespace Parallel {
     return *ng;
   }
 
+  /*
+   * Constrain to better solutions
+   *
+   */
+  void
+  BAB::constrain(const Space& b) {
+    m_search.acquire();
+    Space* c = b.clone(false);
+    if (best != NULL) {
+      // The workers might have found a better solution meanwhile
+      c->constrain(*best);
+      if (c->status() == SS_FAILED) {
+        delete c;
+        m_search.release();
+        return;
+      }
+      delete best;
+    }
+    best = c;
+    // Announce better solution
+    for (unsigned int i=0; i<workers(); i++)
+      worker(i)->better(best);
+    m_search.release();
+  }
+
   /*
    * Termination and deletion
    */
@@ -92,6 +92,8 @@ namespace Gecode { namespace Search { namespace Parallel {
     virtual void reset(Space* s);
     /// Return no-goods
     virtual NoGoods& nogoods(void);
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
     /// Destructor
     virtual ~BAB(void);
     //@}
@@ -117,6 +119,7 @@ namespace Gecode { namespace Search { namespace Parallel {
     delete best;
     best = NULL;
     path.reset((s == NULL) ? 0 : ngdl);
+    deque.reset();
     d = mark = 0;
     idle = false;
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
@@ -201,9 +204,11 @@ namespace Gecode { namespace Search { namespace Parallel {
   forceinline void
   BAB::Worker::find(void) {
     // Try to find new work (even if there is none)
+    unsigned int v = victim();
     for (unsigned int i=0; i<engine().workers(); i++) {
       unsigned long int r_d = 0ul;
-      if (Space* s = engine().worker(i)->steal(r_d)) {
+      Worker* w = engine().worker((v+i) % engine().workers());
+      if (Space* s = w->steal(r_d)) {
         // Reset this guy
         m.acquire();
         idle = false;
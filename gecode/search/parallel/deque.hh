@@ -0,0 +1,166 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef __GECODE_SEARCH_PARALLEL_DEQUE_HH__
+#define __GECODE_SEARCH_PARALLEL_DEQUE_HH__
+
+#include <gecode/search.hh>
+
+namespace Gecode { namespace Search { namespace Parallel {
+
+  /**
+   * \brief Work-stealing deque for donated subtrees
+   *
+   * A Chase-Lev style deque with fixed capacity Config::deque_size. The
+   * owning worker pushes and takes subtrees at the bottom, any other
+   * worker can steal subtrees from the top. Stealing does not take a
+   * lock: a thief claims the topmost entry by a compare-and-swap on
+   * the top index.
+   *
+   * Each entry is a space that is ready for exploration together with
+   * the depth of its root in the search tree.
+   */
+  class Deque {
+  protected:
+    /// Entry of the deque
+    class Entry {
+    public:
+      /// The donated subtree
+      Space* s;
+      /// Depth of the subtree's root
+      unsigned long int d;
+    };
+    /// The entries
+    Entry e[Config::deque_size];
+    /// Top of deque (next entry to be stolen)
+    volatile unsigned int t;
+    /// Bottom of deque (next entry to be pushed)
+    volatile unsigned int b;
+  public:
+    /// Initialize as empty
+    Deque(void);
+    /// Return number of entries (approximate when accessed concurrently)
+    unsigned int entries(void) const;
+    /// Push space \a s at depth \a d, return false if the deque is full (owner)
+    bool push(Space* s, unsigned long int d);
+    /// Take bottommost space and its depth \a d (owner, NULL if empty)
+    Space* take(unsigned long int& d);
+    /// Steal topmost space and its depth \a d (thief, NULL if empty)
+    Space* steal(unsigned long int& d);
+    /// Delete all entries (no concurrent access allowed)
+    void reset(void);
+  };
+
+
+  forceinline
+  Deque::Deque(void) : t(0U), b(0U) {}
+
+  forceinline unsigned int
+  Deque::entries(void) const {
+    unsigned int t0 = t;
+    unsigned int b0 = b;
+    return (static_cast<int>(b0-t0) > 0) ? b0-t0 : 0U;
+  }
+
+  forceinline bool
+  Deque::push(Space* s, unsigned long int d) {
+    unsigned int b0 = b;
+    if (b0 - t >= Config::deque_size)
+      return false;
+    e[b0 & (Config::deque_size-1)].s = s;
+    e[b0 & (Config::deque_size-1)].d = d;
+    // Publish entry before making it visible to thieves
+    Support::Atomic::fence();
+    b = b0+1;
+    return true;
+  }
+
+  forceinline Space*
+  Deque::take(unsigned long int& d) {
+    unsigned int b0 = b-1;
+    b = b0;
+    Support::Atomic::fence();
+    unsigned int t0 = t;
+    if (static_cast<int>(b0-t0) < 0) {
+      // Deque is empty
+      b = t0;
+      return NULL;
+    }
+    Entry x = e[b0 & (Config::deque_size-1)];
+    if (b0 != t0) {
+      // More than one entry, no conflict with thieves possible
+      d = x.d;
+      return x.s;
+    }
+    // Last entry: race against thieves
+    bool won = Support::Atomic::cas(t,t0,t0+1);
+    b = t0+1;
+    if (!won)
+      return NULL;
+    d = x.d;
+    return x.s;
+  }
+
+  forceinline Space*
+  Deque::steal(unsigned long int& d) {
+    unsigned int t0 = t;
+    Support::Atomic::fence();
+    unsigned int b0 = b;
+    if (static_cast<int>(b0-t0) <= 0)
+      return NULL;
+    Entry x = e[t0 & (Config::deque_size-1)];
+    if (!Support::Atomic::cas(t,t0,t0+1))
+      return NULL;
+    d = x.d;
+    return x.s;
+  }
+
+  forceinline void
+  Deque::reset(void) {
+    while (static_cast<int>(b-t) > 0) {
+      delete e[t & (Config::deque_size-1)].s;
+      t++;
+    }
+    t = b = 0U;
+  }
+
+}}}
+
+#endif
+
+// STATISTICS: search-parallel
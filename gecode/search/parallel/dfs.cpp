@@ -89,6 +89,7 @@ namespace Gecode { namespace Search { namespace Parallel {
       case C_WORK:
         // Perform exploration work
         {
+          unsigned long int r_d = 0ul;
           m.acquire();
           if (idle) {
             m.release();
@@ -133,6 +134,8 @@ namespace Gecode { namespace Search { namespace Parallel {
                   const Choice* ch = path.push(*this,cur,c);
                   cur->commit(*ch,0);
                   m.release();
+                  if (engine().opt().steal == SM_DEQUE)
+                    donate();
                 }
                 break;
               default:
@@ -142,6 +145,15 @@ namespace Gecode { namespace Search { namespace Parallel {
           } else if (path.next()) {
             cur = path.recompute(d,engine().opt().a_d,*this);
             m.release();
+          } else if (Space* s = deque.take(r_d)) {
+            // Continue with a subtree that has been donated but not stolen
+            path.ngdl(0);
+            d = 0;
+            cur = s;
+            Search::Worker::reset(r_d);
+            m.release();
+            // Give back the busy count of the donated subtree
+            engine().idle();
           } else {
             idle = true;
             path.ngdl(0);
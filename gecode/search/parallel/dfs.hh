@@ -131,6 +131,7 @@ namespace Gecode { namespace Search { namespace Parallel {
   DFS::Worker::reset(Space* s, int ngdl) {
     delete cur;
     path.reset((s != NULL) ? ngdl : 0);
+    deque.reset();
     d = 0;
     idle = false;
     if ((s == NULL) || (s->status(*this) == SS_FAILED)) {
@@ -164,9 +165,11 @@ namespace Gecode { namespace Search { namespace Parallel {
   forceinline void
   DFS::Worker::find(void) {
     // Try to find new work (even if there is none)
+    unsigned int v = victim();
     for (unsigned int i=0; i<engine().workers(); i++) {
       unsigned long int r_d = 0ul;
-      if (Space* s = engine().worker(i)->steal(r_d)) {
+      Worker* w = engine().worker((v+i) % engine().workers());
+      if (Space* s = w->steal(r_d)) {
         // Reset this guy
         m.acquire();
         idle = false;
@@ -107,6 +107,7 @@ namespace Gecode { namespace Search { namespace Parallel {
    */
   Engine::Worker::~Worker(void) {
     delete cur;
+    deque.reset();
     path.reset(0);
   }
 
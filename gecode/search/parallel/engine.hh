@@ -42,6 +42,7 @@
 #include <gecode/search/support.hh>
 #include <gecode/search/worker.hh>
 #include <gecode/search/parallel/path.hh>
+#include <gecode/search/parallel/deque.hh>
 
 namespace Gecode { namespace Search { namespace Parallel {
 
@@ -63,6 +64,14 @@ namespace Gecode { namespace Search { namespace Parallel {
       unsigned int d;
       /// Whether the worker is idle
       bool idle;
+      /// Subtrees donated for stealing (only used with SM_DEQUE)
+      Deque deque;
+      /// Random number generator for choosing victims
+      Support::RandomGenerator rnd;
+      /// Donate an open alternative from the path to the deque
+      void donate(void);
+      /// Return the first worker to try when looking for work
+      unsigned int victim(void);
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, Engine& e);
@@ -241,7 +250,8 @@ namespace Gecode { namespace Search { namespace Parallel {
   Engine::Worker::Worker(Space* s, Engine& e)
     : _engine(e), 
       path(s == NULL ? 0 : static_cast<int>(e.opt().nogoods_limit)), d(0), 
-      idle(false) {
+      idle(false), 
+      rnd(static_cast<unsigned int>(reinterpret_cast<size_t>(this) >> 4)) {
     if (s != NULL) {
       if (s->status(*this) == SS_FAILED) {
         fail++;
@@ -394,6 +404,12 @@ namespace Gecode { namespace Search { namespace Parallel {
    */
   forceinline Space*
   Engine::Worker::steal(unsigned long int& d) {
+    /*
+     * With work-stealing deques, the thief takes over the busy count
+     * that has been acquired when the subtree has been donated.
+     */
+    if (engine().opt().steal == SM_DEQUE)
+      return deque.steal(d);
     /*
      * Make a quick check whether the worker might have work
      *
@@ -411,6 +427,39 @@ namespace Gecode { namespace Search { namespace Parallel {
     return s;
   }
 
+  forceinline void
+  Engine::Worker::donate(void) {
+    /*
+     * Make a quick check whether donating is worthwhile: only donate
+     * if there is sufficient work left, as for stealing from the path.
+     */
+    if ((deque.entries() >= Config::deque_limit) || !path.steal())
+      return;
+    /*
+     * Each donated subtree counts as a busy worker until it has been
+     * stolen or taken back. The count must be acquired before the
+     * subtree becomes visible to thieves and without holding the mutex.
+     */
+    engine().busy();
+    unsigned long int r_d = 0ul;
+    m.acquire();
+    Space* s = path.steal(*this,r_d);
+    if (s != NULL) {
+      // Only the owner pushes, hence there is always room left
+      bool pushed = deque.push(s,r_d);
+      assert(pushed); (void) pushed;
+    }
+    m.release();
+    if (s == NULL)
+      engine().idle();
+  }
+
+  forceinline unsigned int
+  Engine::Worker::victim(void) {
+    // With deques, start at a random victim to spread the thieves
+    return (engine().opt().steal == SM_DEQUE) ? rnd(engine().workers()) : 0U;
+  }
+
   /*
    * Return No-Goods
    */
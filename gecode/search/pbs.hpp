@@ -0,0 +1,171 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode {
+
+  namespace Search {
+    GECODE_SEARCH_EXPORT Stop* pbsstop(Stop* so);
+    GECODE_SEARCH_EXPORT Engine* pbs(Engine** slaves, Stop** stops,
+                                     unsigned int n, bool best);
+  }
+
+  namespace Search { namespace Meta {
+
+    /// Traits class for portfolio-based search
+    template<template<class> class E, class T>
+    class PBSTraits {
+    public:
+      /// Whether engine \a E performs best solution search
+      static const bool best = false;
+    };
+
+    /// Traits class for portfolio-based search with branch-and-bound
+    template<class T>
+    class PBSTraits<BAB,T> {
+    public:
+      /// Whether engine \a E performs best solution search
+      static const bool best = true;
+    };
+
+  }}
+
+  template<template<class> class E, class T>
+  void
+  PBS<E,T>::build(T* s, const Search::Options* ao, unsigned int n,
+                  const Search::Options& m_opt) {
+    Search::Engine** slaves = heap.alloc<Search::Engine*>(n);
+    Search::Stop** stops = heap.alloc<Search::Stop*>(n);
+    // Propagate only once for all assets
+    Space* master;
+    if (s->status() == SS_FAILED) {
+      if (!m_opt.clone)
+        delete s;
+      master = NULL;
+    } else {
+      master = m_opt.clone ? s->clone() : s;
+    }
+    // Assets must not share data as they run in different threads
+    Space** as = heap.alloc<Space*>(n);
+    if (master == NULL) {
+      for (unsigned int i=0; i<n; i++)
+        as[i] = NULL;
+    } else {
+      master->clone(as,n-1,false);
+      as[n-1] = master;
+    }
+    for (unsigned int i=0; i<n; i++) {
+      Space* a = as[i];
+      if (a != NULL)
+        a->asset(i);
+      Search::Options e_opt(ao[i]);
+      e_opt.clone = false;
+      stops[i] = Search::pbsstop(m_opt.stop);
+      e_opt.stop = stops[i];
+      if (ao[i].cutoff != NULL) {
+        RBS<E,T> r(dynamic_cast<T*>(a),e_opt);
+        EngineBase* eb = &r;
+        slaves[i] = eb->e;
+        eb->e = NULL;
+      } else {
+        E<T> r(dynamic_cast<T*>(a),e_opt);
+        EngineBase* eb = &r;
+        slaves[i] = eb->e;
+        eb->e = NULL;
+      }
+    }
+    heap.free<Space*>(as,n);
+    e = Search::pbs(slaves,stops,n,Search::Meta::PBSTraits<E,T>::best);
+  }
+
+  template<template<class> class E, class T>
+  forceinline
+  PBS<E,T>::PBS(T* s, const Search::Options& o) {
+    Search::Options m_opt(o.expand());
+    unsigned int n = (o.assets > 0) ? o.assets :
+      static_cast<unsigned int>(m_opt.threads);
+    if (n == 0)
+      n = 1;
+    Search::Options* ao = heap.alloc<Search::Options>(n);
+    for (unsigned int i=0; i<n; i++) {
+      ao[i] = o;
+      ao[i].threads = 1.0;
+      ao[i].cutoff = NULL;
+    }
+    ao[0].cutoff = o.cutoff;
+    build(s,ao,n,o);
+    heap.free<Search::Options>(ao,n);
+  }
+
+  template<template<class> class E, class T>
+  forceinline
+  PBS<E,T>::PBS(T* s, const Search::Options ao[], unsigned int n,
+                const Search::Options& o) {
+    if (n == 0)
+      throw Search::NoAssets("PBS::PBS");
+    build(s,ao,n,o);
+  }
+
+  template<template<class> class E, class T>
+  forceinline T*
+  PBS<E,T>::next(void) {
+    return dynamic_cast<T*>(e->next());
+  }
+
+  template<template<class> class E, class T>
+  forceinline Search::Statistics
+  PBS<E,T>::statistics(void) const {
+    return e->statistics();
+  }
+
+  template<template<class> class E, class T>
+  forceinline bool
+  PBS<E,T>::stopped(void) const {
+    return e->stopped();
+  }
+
+
+  template<template<class> class E, class T>
+  forceinline T*
+  pbs(T* s, const Search::Options& o) {
+    PBS<E,T> p(s,o);
+    return p.next();
+  }
+
+}
+
+// STATISTICS: search-other
@@ -75,6 +75,8 @@ namespace Gecode { namespace Search { namespace Sequential {
     void reset(Space* s);
     /// Return no-goods
     NoGoods& nogoods(void);
+    /// Constrain future solutions to be better than \a b
+    void constrain(const Space& b);
     /// Destructor
     ~BAB(void);
   };
@@ -179,6 +181,15 @@ namespace Gecode { namespace Search { namespace Sequential {
     return path;
   }
 
+  forceinline void
+  BAB::constrain(const Space& b) {
+    delete best;
+    best = b.clone(false);
+    mark = path.entries();
+    if (cur != NULL)
+      cur->constrain(*best);
+  }
+
   forceinline 
   BAB::~BAB(void) {
     path.reset();
@@ -67,6 +67,8 @@ namespace Gecode { namespace Search { namespace Sequential {
     void reset(Space* s);
     /// Return no-goods
     NoGoods& nogoods(void);
+    /// Constrain future solutions to be better than \a b (does nothing)
+    void constrain(const Space& b);
     /// Destructor
     ~DFS(void);
   };
@@ -102,6 +104,10 @@ namespace Gecode { namespace Search { namespace Sequential {
     return path;
   }
 
+  forceinline void
+  DFS::constrain(const Space&) {
+  }
+
   forceinline Space*
   DFS::next(void) {
     start();
@@ -57,6 +57,11 @@ namespace Gecode { namespace Search { namespace Sequential {
    * distance is at least this large, an additional
    * clone is created.
    *
+   * If all edges between the last clone and the top of the
+   * path are rightmost, the clone is not needed anymore after
+   * recomputation and is used directly instead of being cloned
+   * (a generalization of the last alternative optimization).
+   *
    */
   class Path : public NoGoods {
     friend class Search::Meta::NoGoodsProp;
@@ -124,6 +129,8 @@ namespace Gecode { namespace Search { namespace Sequential {
     int lc(void) const;
     /// Unwind the stack up to position \a l (after failure)
     void unwind(int l);
+    /// Test whether clone at position \a l is not needed after recomputation
+    bool reusable(int l) const;
     /// Commit space \a s as described by stack entry at position \a i
     void commit(Space* s, int i) const;
     /// Recompute space according to path 
@@ -272,6 +279,14 @@ namespace Gecode { namespace Search { namespace Sequential {
     return ds.entries();
   }
 
+  forceinline bool
+  Path::reusable(int l) const {
+    for (int i=ds.entries(); i-- > l; )
+      if (!ds[i].rightmost())
+        return false;
+    return true;
+  }
+
   forceinline void
   Path::unwind(int l) {
     assert((ds[l].space() == NULL) || ds[l].space()->failed());
@@ -311,6 +326,16 @@ namespace Gecode { namespace Search { namespace Sequential {
     // New distance, if no adaptive recomputation
     d = static_cast<unsigned int>(n - l);
 
+    // Only rightmost alternatives left: use last clone without cloning
+    if (reusable(l)) {
+      Space* s = ds[l].space();
+      ds[l].space(NULL);
+      for (int i=l; i<n; i++)
+        commit(s,i);
+      d = 0;
+      return s;
+    }
+
     Space* s = ds[l].space()->clone(); // Last clone
 
     if (d < a_d) {
@@ -393,11 +418,26 @@ namespace Gecode { namespace Search { namespace Sequential {
         unwind(l);
         return NULL;
       }
+      // Only rightmost alternatives left: use last clone without cloning
+      if (reusable(l)) {
+        ds[l].space(NULL);
+        for (int i=l; i<n; i++)
+          commit(s,i);
+        d = 0;
+        return s;
+      }
       // It is important to replace the space on the stack with the
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
       Space* c = s->clone();
       ds[l].space(c);
+    } else if (reusable(l)) {
+      // Only rightmost alternatives left: use last clone without cloning
+      ds[l].space(NULL);
+      for (int i=l; i<n; i++)
+        commit(s,i);
+      d = 0;
+      return s;
     } else {
       s = s->clone();
     }
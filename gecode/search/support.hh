@@ -65,6 +65,8 @@ namespace Gecode { namespace Search {
     virtual void reset(Space* s);
     /// Return no-goods
     virtual NoGoods& nogoods(void);
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
   };
 
 
@@ -105,6 +107,12 @@ namespace Gecode { namespace Search {
     return w.nogoods();
   }
 
+  template<class Worker>
+  void
+  WorkerToEngine<Worker>::constrain(const Space& b) {
+    w.constrain(b);
+  }
+
 }}
 
 #endif
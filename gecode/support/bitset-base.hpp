@@ -100,6 +100,18 @@ namespace Gecode { namespace Support {
     bool none(void) const;
     /// Whether no bits from bit 0 to bit \a i are set
     bool none(unsigned int i) const;
+    /// Return number of bits set
+    unsigned int count(void) const;
+    /// Return number of bits set from bit 0 to bit \a i
+    unsigned int count(unsigned int i) const;
+    /// Perform "and" with \a b
+    void inter(BitSetData b);
+    /// Perform "or" with \a b
+    void unite(BitSetData b);
+    /// Clear all bits that are set in \a b
+    void minus(BitSetData b);
+    /// Test whether some bit is set in both this and \a b
+    bool intersects(BitSetData b) const;
   };
 
   /// Status of a bitset
@@ -151,6 +163,16 @@ namespace Gecode { namespace Support {
     unsigned int next(unsigned int i) const;
     /// Return status of bitset
     BitSetStatus status(void) const;
+    /// Return number of bits set
+    unsigned int count(void) const;
+    /// Intersect with bitset \a bs (must have the same size)
+    void inter(const BitSetBase& bs);
+    /// Union with bitset \a bs (must have the same size)
+    void unite(const BitSetBase& bs);
+    /// Remove all bits set in bitset \a bs (must have the same size)
+    void minus(const BitSetBase& bs);
+    /// Test whether some bit is set in both this and \a bs (must have the same size)
+    bool intersects(const BitSetBase& bs) const;
     /// Resize bitset to \a n elememts
     template<class A>
     void resize(A& a, unsigned int n, bool set=false);
@@ -202,12 +224,12 @@ namespace Gecode { namespace Support {
     unsigned long int p;
     _BitScanForward64(&p,bits >> i);
     return static_cast<unsigned int>(p)+i;
+#elif defined(GECODE_HAS_BUILTIN_CTZL)
+    return static_cast<unsigned int>(__builtin_ctzl(bits >> i))+i;
 #elif defined(GECODE_HAS_BUILTIN_FFSL)
-    if ((bpb == 32) || (bpb == 64)) {
-      int p = __builtin_ffsl(bits >> i);
-      assert(p > 0);
-      return static_cast<unsigned int>(p-1)+i;
-    }
+    int p = __builtin_ffsl(bits >> i);
+    assert(p > 0);
+    return static_cast<unsigned int>(p-1)+i;
 #else
     while (!get(i)) i++;
     return i;
@@ -231,6 +253,44 @@ namespace Gecode { namespace Support {
     const Base mask = (static_cast<Base>(1U) << i) - static_cast<Base>(1U);
     return (bits & mask) == static_cast<Base>(0U);
   }
+  forceinline unsigned int
+  BitSetData::count(void) const {
+#if defined(GECODE_HAS_BUILTIN_POPCOUNTL)
+    return static_cast<unsigned int>(__builtin_popcountl(bits));
+#else
+    // Count bits in parallel within the word (works for any word size)
+    const Base m1 = ~static_cast<Base>(0U) / 3U;
+    const Base m2 = ~static_cast<Base>(0U) / 15U * 3U;
+    const Base m4 = ~static_cast<Base>(0U) / 255U * 15U;
+    const Base h1 = ~static_cast<Base>(0U) / 255U;
+    Base b = bits - ((bits >> 1) & m1);
+    b = (b & m2) + ((b >> 2) & m2);
+    b = (b + (b >> 4)) & m4;
+    return static_cast<unsigned int>((b * h1) >> ((sizeof(Base)-1) * CHAR_BIT));
+#endif
+  }
+  forceinline unsigned int
+  BitSetData::count(unsigned int i) const {
+    BitSetData m;
+    m.bits = bits & ((static_cast<Base>(1U) << i) - static_cast<Base>(1U));
+    return m.count();
+  }
+  forceinline void
+  BitSetData::inter(BitSetData b) {
+    bits &= b.bits;
+  }
+  forceinline void
+  BitSetData::unite(BitSetData b) {
+    bits |= b.bits;
+  }
+  forceinline void
+  BitSetData::minus(BitSetData b) {
+    bits &= ~b.bits;
+  }
+  forceinline bool
+  BitSetData::intersects(BitSetData b) const {
+    return (bits & b.bits) != static_cast<Base>(0U);
+  }
 
 
 
@@ -371,6 +431,62 @@ namespace Gecode { namespace Support {
     return BSS_SOME;
   }
 
+  /*
+   * The following bulk operations work word by word on the data. The
+   * sentinel bit at position sz is set in all bitsets, it must be
+   * excluded from counting and intersection tests and restored after
+   * computing a difference. The loops are kept free of early exits
+   * where possible so that the compiler can vectorize them.
+   *
+   */
+
+  forceinline unsigned int
+  BitSetBase::count(void) const {
+    unsigned int pos = sz / bpb;
+    unsigned int c = data[pos].count(sz % bpb);
+    for (unsigned int i=0; i<pos; i++)
+      c += data[i].count();
+    return c;
+  }
+
+  forceinline void
+  BitSetBase::inter(const BitSetBase& bs) {
+    assert(sz == bs.sz);
+    for (unsigned int i=BitSetData::data(sz+1); i--; )
+      data[i].inter(bs.data[i]);
+  }
+
+  forceinline void
+  BitSetBase::unite(const BitSetBase& bs) {
+    assert(sz == bs.sz);
+    for (unsigned int i=BitSetData::data(sz+1); i--; )
+      data[i].unite(bs.data[i]);
+  }
+
+  forceinline void
+  BitSetBase::minus(const BitSetBase& bs) {
+    assert(sz == bs.sz);
+    for (unsigned int i=BitSetData::data(sz+1); i--; )
+      data[i].minus(bs.data[i]);
+    // Restore the sentinel
+    _set(sz);
+  }
+
+  forceinline bool
+  BitSetBase::intersects(const BitSetBase& bs) const {
+    assert(sz == bs.sz);
+    unsigned int pos = sz / bpb;
+    // Only consider the bits before the sentinel in the last word
+    BitSetData l = data[pos];
+    l.inter(bs.data[pos]);
+    if (!l.none(sz % bpb))
+      return true;
+    for (unsigned int i=0; i<pos; i++)
+      if (data[i].intersects(bs.data[i]))
+        return true;
+    return false;
+  }
+
 }}
 
 #ifdef GECODE_SUPPORT_MSVC_32
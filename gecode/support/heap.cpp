@@ -37,6 +37,10 @@
 
 #include <gecode/support.hh>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 namespace Gecode {
 
   forceinline
@@ -46,6 +50,27 @@ namespace Gecode {
 #endif
   {}
 
+  void*
+  Heap::hpalloc(size_t s, size_t a) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    void* p;
+    if (::posix_memalign(&p,a,s) != 0)
+      throw MemoryExhausted();
+#ifdef GECODE_PEAKHEAP
+    _m.acquire();
+    _cur += GECODE_MSIZE(p);
+    _peak = std::max(_peak,_cur);
+    _m.release();
+#endif
+    // The advice is only a hint, hence failure can be ignored
+    (void) ::madvise(p,s,MADV_HUGEPAGE);
+    return p;
+#else
+    (void) a;
+    return ralloc(s);
+#endif
+  }
+
   Heap heap;
 
 }
@@ -308,6 +308,15 @@ namespace Gecode {
     void  rfree(void* p, size_t s);
     /// Change memory block starting at \a p to size \a s
     void* rrealloc(void* p, size_t s);
+    /**
+     * \brief Allocate \a s bytes aligned to \a a bytes backed by huge pages
+     *
+     * The operating system is advised to back the memory by huge pages,
+     * where \a a must be the size of a huge page. If huge pages are
+     * not supported, the memory is allocated as by ralloc. In either
+     * case the memory must be freed by rfree.
+     */
+    GECODE_SUPPORT_EXPORT void* hpalloc(size_t s, size_t a);
     //@}
   private:
     /// Allocate memory from heap (disabled)
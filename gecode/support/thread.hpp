@@ -250,6 +250,32 @@ namespace Gecode { namespace Support {
     void operator=(const Event&) {}
   };
 
+  /**
+   * \brief Atomic operations on shared words
+   *
+   * Only the operations needed for lock-free work-stealing in the
+   * parallel search engines and for reference counting of objects
+   * shared between threads are provided.
+   *
+   * \ingroup FuncSupportThread
+   */
+  class Atomic {
+  public:
+    /**
+     * \brief Replace \a v by \a n if \a v equals \a o
+     *
+     * Returns true if the replacement has been performed. The operation
+     * implies a full memory barrier.
+     */
+    static bool cas(volatile unsigned int& v, unsigned int o, unsigned int n);
+    /// Increment \a v and return the new value (implies a full memory barrier)
+    static unsigned int inc(volatile unsigned int& v);
+    /// Decrement \a v and return the new value (implies a full memory barrier)
+    static unsigned int dec(volatile unsigned int& v);
+    /// Full memory barrier
+    static void fence(void);
+  };
+
   /**
    * \brief An interface for objects that can be run by a thread
    *
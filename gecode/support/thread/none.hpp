@@ -67,6 +67,28 @@ namespace Gecode { namespace Support {
   Event::~Event(void) {}
 
 
+  /*
+   * Atomic operations
+   */
+  forceinline bool
+  Atomic::cas(volatile unsigned int& v, unsigned int o, unsigned int n) {
+    if (v != o)
+      return false;
+    v = n;
+    return true;
+  }
+  forceinline unsigned int
+  Atomic::inc(volatile unsigned int& v) {
+    return ++v;
+  }
+  forceinline unsigned int
+  Atomic::dec(volatile unsigned int& v) {
+    return --v;
+  }
+  forceinline void
+  Atomic::fence(void) {}
+
+
   /*
    * Thread
    */
@@ -168,6 +168,27 @@ namespace Gecode { namespace Support {
   }
 
 
+  /*
+   * Atomic operations
+   */
+  forceinline bool
+  Atomic::cas(volatile unsigned int& v, unsigned int o, unsigned int n) {
+    return __sync_bool_compare_and_swap(&v,o,n);
+  }
+  forceinline unsigned int
+  Atomic::inc(volatile unsigned int& v) {
+    return __sync_add_and_fetch(&v,1U);
+  }
+  forceinline unsigned int
+  Atomic::dec(volatile unsigned int& v) {
+    return __sync_sub_and_fetch(&v,1U);
+  }
+  forceinline void
+  Atomic::fence(void) {
+    __sync_synchronize();
+  }
+
+
   /*
    * Thread
    */
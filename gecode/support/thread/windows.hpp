@@ -88,6 +88,32 @@ namespace Gecode { namespace Support {
   }
 
 
+  /*
+   * Atomic operations
+   */
+  forceinline bool
+  Atomic::cas(volatile unsigned int& v, unsigned int o, unsigned int n) {
+    return static_cast<unsigned int>
+      (InterlockedCompareExchange(reinterpret_cast<volatile LONG*>(&v),
+                                  static_cast<LONG>(n),
+                                  static_cast<LONG>(o))) == o;
+  }
+  forceinline unsigned int
+  Atomic::inc(volatile unsigned int& v) {
+    return static_cast<unsigned int>
+      (InterlockedIncrement(reinterpret_cast<volatile LONG*>(&v)));
+  }
+  forceinline unsigned int
+  Atomic::dec(volatile unsigned int& v) {
+    return static_cast<unsigned int>
+      (InterlockedDecrement(reinterpret_cast<volatile LONG*>(&v)));
+  }
+  forceinline void
+  Atomic::fence(void) {
+    MemoryBarrier();
+  }
+
+
   /*
    * Thread
    */
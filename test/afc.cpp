@@ -138,6 +138,65 @@ namespace Test {
 
   AFC afc;
 
+  /// %Test for scheduling propagators according to %AFC
+  class AFCSchedule : public Test::Base {
+  protected:
+    /// Test space for n-queens
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Queen positions
+      Gecode::IntVarArray q;
+      /// Constructor for creation
+      TestSpace(int n, bool s) : q(*this,n,0,n-1) {
+        using namespace Gecode;
+        afc_schedule(s);
+        for (int i=0; i<n; i++)
+          for (int j=i+1; j<n; j++)
+            rel(*this, q[i], IRT_NQ, q[j]);
+        distinct(*this, q, ICL_DOM);
+        distinct(*this, IntArgs::create(n,0,1), q, ICL_VAL);
+        distinct(*this, IntArgs::create(n,0,-1), q, ICL_BND);
+        branch(*this, q, INT_VAR_AFC_MAX(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      TestSpace(bool share, TestSpace& s) : Space(share,s) {
+        q.update(*this,share,s.q);
+      }
+      /// Copy during cloning
+      virtual Space* copy(bool share) {
+        return new TestSpace(share,*this);
+      }
+    };
+    /// Count solutions for \a n queens and return search statistics
+    unsigned int solutions(int n, bool s, Gecode::Search::Statistics& st) {
+      Gecode::DFS<TestSpace> e(new TestSpace(n,s));
+      unsigned int k = 0;
+      while (TestSpace* t = e.next()) {
+        delete t; k++;
+      }
+      st = e.statistics();
+      return k;
+    }
+  public:
+    /// Initialize test
+    AFCSchedule(void) : Test::Base("AFC::Schedule") {}
+    /// Perform actual tests
+    bool run(void) {
+      for (int n=4; n<=8; n++) {
+        Gecode::Search::Statistics st, ss;
+        // Scheduling must not change the set of solutions
+        if (solutions(n,false,st) != solutions(n,true,ss))
+          return false;
+        // Queue operations must be counted
+        if ((st.enqueue == 0) || (ss.enqueue == 0))
+          return false;
+      }
+      return true;
+    }
+  };
+
+  AFCSchedule afc_schedule;
+
 }
 
 // STATISTICS: test-core
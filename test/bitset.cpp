@@ -0,0 +1,158 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     Christian Schulte <schulte@gecode.org>
+ *
+ *  Copyright:
+ *     Christian Schulte, 2014
+ *
+ *  Last modified:
+ *     $Date$ by $Author$
+ *     $Revision$
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/support.hh>
+
+#include "test/test.hh"
+
+#include <sstream>
+
+namespace Test {
+
+  /// %Tests for bitsets
+  namespace BitSet {
+
+    /// Return name for \a n bits with density \a p
+    std::string opsname(unsigned int n, unsigned int p) {
+      std::ostringstream s;
+      s << "BitSet::Ops::" << n << "::" << p;
+      return s.str();
+    }
+
+    /// %Test word-level operations on bitsets against a plain reference
+    class Ops : public Test::Base {
+    protected:
+      /// Number of bits
+      unsigned int n;
+      /// Density of bits set (in percent)
+      unsigned int p;
+      /// Fill bitset \a b and reference \a r randomly
+      void fill(Gecode::Support::BitSetBase& b, bool* r) const {
+        for (unsigned int i=0; i<n; i++) {
+          r[i] = Base::rand(100) < p;
+          if (r[i])
+            b.set(i);
+        }
+      }
+      /// Check that bitset \a b and reference \a r agree
+      bool same(const Gecode::Support::BitSetBase& b, const bool* r) const {
+        unsigned int c = 0;
+        for (unsigned int i=0; i<n; i++) {
+          if (b.get(i) != r[i])
+            return false;
+          if (r[i])
+            c++;
+        }
+        if (b.count() != c)
+          return false;
+        // Check next against the reference
+        for (unsigned int i=0; i<=n; i++) {
+          unsigned int j = i;
+          while ((j < n) && !r[j])
+            j++;
+          if (b.next(i) != j)
+            return false;
+        }
+        Gecode::Support::BitSetStatus s =
+          (c == 0) ? Gecode::Support::BSS_NONE :
+          ((c == n) ? Gecode::Support::BSS_ALL : Gecode::Support::BSS_SOME);
+        return (n == 0) || (b.status() == s);
+      }
+    public:
+      /// Create and register test for \a n0 bits with density \a p0
+      Ops(unsigned int n0, unsigned int p0)
+        : Test::Base(opsname(n0,p0)), n(n0), p(p0) {}
+      /// Perform test
+      virtual bool run(void) {
+        using namespace Gecode;
+        bool* rx = heap.alloc<bool>(n+1);
+        bool* ry = heap.alloc<bool>(n+1);
+        bool ok = true;
+        for (int k=0; ok && (k<20); k++) {
+          Support::BitSetBase x(heap,n);
+          Support::BitSetBase y(heap,n);
+          fill(x,rx); fill(y,ry);
+          ok = same(x,rx) && same(y,ry);
+          // Intersection test
+          bool i = false;
+          for (unsigned int j=0; j<n; j++)
+            i |= rx[j] && ry[j];
+          ok = ok && (x.intersects(y) == i) && (y.intersects(x) == i);
+          // Bulk operations
+          Support::BitSetBase a(heap,x), o(heap,x), d(heap,x);
+          a.inter(y); o.unite(y); d.minus(y);
+          bool* r = heap.alloc<bool>(n+1);
+          for (unsigned int j=0; j<n; j++)
+            r[j] = x.get(j) && ry[j];
+          ok = ok && same(a,r);
+          for (unsigned int j=0; j<n; j++)
+            r[j] = x.get(j) || ry[j];
+          ok = ok && same(o,r);
+          for (unsigned int j=0; j<n; j++)
+            r[j] = x.get(j) && !ry[j];
+          ok = ok && same(d,r);
+          heap.free<bool>(r,n+1);
+          x.dispose(heap); y.dispose(heap);
+          a.dispose(heap); o.dispose(heap); d.dispose(heap);
+        }
+        heap.free<bool>(rx,n+1);
+        heap.free<bool>(ry,n+1);
+        return ok;
+      }
+    };
+
+    /// Help class to create and register tests
+    class Create {
+    public:
+      /// Perform creation and registration
+      Create(void) {
+        unsigned int n[] = {0,1,31,32,33,63,64,65,127,128,129,1000};
+        unsigned int p[] = {0,10,50,90,100};
+        for (unsigned int i=0; i<sizeof(n)/sizeof(unsigned int); i++)
+          for (unsigned int j=0; j<sizeof(p)/sizeof(unsigned int); j++)
+            (void) new Ops(n[i],p[j]);
+      }
+    };
+
+    Create c;
+
+  }
+
+}
+
+// STATISTICS: test-core
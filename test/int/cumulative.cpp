@@ -73,10 +73,11 @@ namespace Test { namespace Int {
       ManFixPCumulative(int c0, 
                        const Gecode::IntArgs& p0,
                        const Gecode::IntArgs& u0,
-                       int o0)
-        : Test("Cumulative::Man::Fix::"+str(o0)+"::"+
+                       int o0, Gecode::IntConLevel icl0)
+        : Test("Cumulative::Man::Fix::"+str(icl0)+"::"+str(o0)+"::"+
                str(c0)+"::"+str(p0)+"::"+str(u0),
-               (c0 >= 0) ? p0.size():p0.size()+1,0,st(c0,p0,u0)), 
+               (c0 >= 0) ? p0.size():p0.size()+1,0,st(c0,p0,u0),
+               false,icl0), 
           c(c0), p(p0), u(u0), o(o0) {
         testsearch = false;
         testfix = false;
@@ -140,10 +141,10 @@ namespace Test { namespace Int {
             xx[i]=Gecode::expr(home,x[i]+o,Gecode::ICL_DOM);
         }
         if (c >= 0) {
-          Gecode::cumulative(home, c, xx, p, u);
+          Gecode::cumulative(home, c, xx, p, u, icl);
         } else {
           Gecode::rel(home, x[n] <= -c);
-          Gecode::cumulative(home, x[n], xx, p, u);
+          Gecode::cumulative(home, x[n], xx, p, u, icl);
         }
       }
     };
@@ -175,10 +176,11 @@ namespace Test { namespace Int {
       OptFixPCumulative(int c0, 
                         const Gecode::IntArgs& p0,
                         const Gecode::IntArgs& u0,
-                        int o0)
-        : Test("Cumulative::Opt::Fix::"+str(o0)+"::"+
+                        int o0, Gecode::IntConLevel icl0)
+        : Test("Cumulative::Opt::Fix::"+str(icl0)+"::"+str(o0)+"::"+
                str(c0)+"::"+str(p0)+"::"+str(u0),
-               (c0 >= 0) ? 2*p0.size() : 2*p0.size()+1,0,st(c0,p0,u0)), 
+               (c0 >= 0) ? 2*p0.size() : 2*p0.size()+1,0,st(c0,p0,u0),
+               false,icl0), 
           c(c0), p(p0), u(u0), l(st(c,p,u)/2), o(o0) {
         testsearch = false;
         testfix = false;
@@ -247,10 +249,10 @@ namespace Test { namespace Int {
         }
 
         if (c >= 0) {
-          Gecode::cumulative(home, c, s, p, u, m);
+          Gecode::cumulative(home, c, s, p, u, m, icl);
         } else {
           Gecode::rel(home, x[nn] <= -c);
-          Gecode::cumulative(home, x[nn], s, p, u, m);
+          Gecode::cumulative(home, x[nn], s, p, u, m, icl);
         }
       }
     };
@@ -279,11 +281,11 @@ namespace Test { namespace Int {
       /// Create and register test
       ManFlexCumulative(int c0, int minP, int maxP,
                         const Gecode::IntArgs& u0,
-                        int o0)
-        : Test("Cumulative::Man::Flex::"+str(o0)+"::"+
+                        int o0, Gecode::IntConLevel icl0)
+        : Test("Cumulative::Man::Flex::"+str(icl0)+"::"+str(o0)+"::"+
                str(c0)+"::"+str(minP)+"::"+str(maxP)+"::"+str(u0),
                (c0 >= 0) ? 2*u0.size() : 2*u0.size()+1,
-               0,std::max(maxP,st(c0,maxP,u0))), 
+               0,std::max(maxP,st(c0,maxP,u0)),false,icl0), 
           c(c0), _minP(minP), _maxP(maxP), u(u0), o(o0) {
         testsearch = false;
         testfix = false;
@@ -356,10 +358,10 @@ namespace Test { namespace Int {
           rel(home, _maxP >= px[i]);
         }
         if (c >= 0) {
-          Gecode::cumulative(home, c, s, px, e, u);
+          Gecode::cumulative(home, c, s, px, e, u, icl);
         } else {
           rel(home, x[n] <= -c);
-          Gecode::cumulative(home, x[n], s, px, e, u);
+          Gecode::cumulative(home, x[n], s, px, e, u, icl);
         }
       }
     };
@@ -390,11 +392,11 @@ namespace Test { namespace Int {
       /// Create and register test
       OptFlexCumulative(int c0, int minP, int maxP,
                         const Gecode::IntArgs& u0,
-                        int o0)
-        : Test("Cumulative::Opt::Flex::"+str(o0)+"::"+
+                        int o0, Gecode::IntConLevel icl0)
+        : Test("Cumulative::Opt::Flex::"+str(icl0)+"::"+str(o0)+"::"+
                str(c0)+"::"+str(minP)+"::"+str(maxP)+"::"+str(u0),
                (c0 >= 0) ? 3*u0.size() : 3*u0.size()+1,
-               0,std::max(maxP,st(c0,maxP,u0))), 
+               0,std::max(maxP,st(c0,maxP,u0)),false,icl0), 
           c(c0), _minP(minP), _maxP(maxP), u(u0), 
           l(std::max(maxP,st(c0,maxP,u0))/2), o(o0) {
         testsearch = false;
@@ -473,10 +475,10 @@ namespace Test { namespace Int {
         for (int i=0; i<n; i++)
           m[i]=Gecode::expr(home, (x[n+i] > l));
         if (c >= 0) {
-          Gecode::cumulative(home, c, s, px, e, u, m);
+          Gecode::cumulative(home, c, s, px, e, u, m, icl);
         } else {
           Gecode::rel(home, x[2*n] <= -c);
-          Gecode::cumulative(home, x[2*n], s, px, e, u, m);
+          Gecode::cumulative(home, x[2*n], s, px, e, u, m, icl);
         }
       }
     };
@@ -500,74 +502,76 @@ namespace Test { namespace Int {
         // Regression test: check correct detection of disjunctive case
         IntArgs p5(3, 1,1,1);
         IntArgs u5(3, 1,3,2);
-        (void) new ManFixPCumulative(3,p5,u5,0);
+        (void) new ManFixPCumulative(3,p5,u5,0,ICL_DEF);
 
-        for (int c=-7; c<8; c++) {
-          int off = 0;
-          for (int coff=0; coff<2; coff++) {
-            (void) new ManFixPCumulative(c,p1,u1,off);
-            (void) new ManFixPCumulative(c,p1,u2,off);
-            (void) new ManFixPCumulative(c,p1,u3,off);
-            (void) new ManFixPCumulative(c,p1,u4,off);
-            (void) new ManFixPCumulative(c,p2,u1,off);
-            (void) new ManFixPCumulative(c,p2,u2,off);
-            (void) new ManFixPCumulative(c,p2,u3,off);
-            (void) new ManFixPCumulative(c,p2,u4,off);
-            (void) new ManFixPCumulative(c,p3,u1,off);
-            (void) new ManFixPCumulative(c,p3,u2,off);
-            (void) new ManFixPCumulative(c,p3,u3,off);
-            (void) new ManFixPCumulative(c,p3,u4,off);
-            (void) new ManFixPCumulative(c,p4,u1,off);
-            (void) new ManFixPCumulative(c,p4,u2,off);
-            (void) new ManFixPCumulative(c,p4,u3,off);
-            (void) new ManFixPCumulative(c,p4,u4,off);
+        IntConLevel icls[] = {ICL_DEF, ICL_DOM};
+        for (int i=0; i<2; i++)
+          for (int c=-7; c<8; c++) {
+            int off = 0;
+            for (int coff=0; coff<2; coff++) {
+              (void) new ManFixPCumulative(c,p1,u1,off,icls[i]);
+              (void) new ManFixPCumulative(c,p1,u2,off,icls[i]);
+              (void) new ManFixPCumulative(c,p1,u3,off,icls[i]);
+              (void) new ManFixPCumulative(c,p1,u4,off,icls[i]);
+              (void) new ManFixPCumulative(c,p2,u1,off,icls[i]);
+              (void) new ManFixPCumulative(c,p2,u2,off,icls[i]);
+              (void) new ManFixPCumulative(c,p2,u3,off,icls[i]);
+              (void) new ManFixPCumulative(c,p2,u4,off,icls[i]);
+              (void) new ManFixPCumulative(c,p3,u1,off,icls[i]);
+              (void) new ManFixPCumulative(c,p3,u2,off,icls[i]);
+              (void) new ManFixPCumulative(c,p3,u3,off,icls[i]);
+              (void) new ManFixPCumulative(c,p3,u4,off,icls[i]);
+              (void) new ManFixPCumulative(c,p4,u1,off,icls[i]);
+              (void) new ManFixPCumulative(c,p4,u2,off,icls[i]);
+              (void) new ManFixPCumulative(c,p4,u3,off,icls[i]);
+              (void) new ManFixPCumulative(c,p4,u4,off,icls[i]);
 
-            (void) new ManFlexCumulative(c,0,1,u1,off);
-            (void) new ManFlexCumulative(c,0,1,u2,off);
-            (void) new ManFlexCumulative(c,0,1,u3,off);
-            (void) new ManFlexCumulative(c,0,1,u4,off);
-            (void) new ManFlexCumulative(c,0,2,u1,off);
-            (void) new ManFlexCumulative(c,0,2,u2,off);
-            (void) new ManFlexCumulative(c,0,2,u3,off);
-            (void) new ManFlexCumulative(c,0,2,u4,off);
-            (void) new ManFlexCumulative(c,3,5,u1,off);
-            (void) new ManFlexCumulative(c,3,5,u2,off);
-            (void) new ManFlexCumulative(c,3,5,u3,off);
-            (void) new ManFlexCumulative(c,3,5,u4,off);
+              (void) new ManFlexCumulative(c,0,1,u1,off,icls[i]);
+              (void) new ManFlexCumulative(c,0,1,u2,off,icls[i]);
+              (void) new ManFlexCumulative(c,0,1,u3,off,icls[i]);
+              (void) new ManFlexCumulative(c,0,1,u4,off,icls[i]);
+              (void) new ManFlexCumulative(c,0,2,u1,off,icls[i]);
+              (void) new ManFlexCumulative(c,0,2,u2,off,icls[i]);
+              (void) new ManFlexCumulative(c,0,2,u3,off,icls[i]);
+              (void) new ManFlexCumulative(c,0,2,u4,off,icls[i]);
+              (void) new ManFlexCumulative(c,3,5,u1,off,icls[i]);
+              (void) new ManFlexCumulative(c,3,5,u2,off,icls[i]);
+              (void) new ManFlexCumulative(c,3,5,u3,off,icls[i]);
+              (void) new ManFlexCumulative(c,3,5,u4,off,icls[i]);
 
-            (void) new OptFixPCumulative(c,p1,u1,off);
-            (void) new OptFixPCumulative(c,p1,u2,off);
-            (void) new OptFixPCumulative(c,p1,u3,off);
-            (void) new OptFixPCumulative(c,p1,u4,off);
-            (void) new OptFixPCumulative(c,p2,u1,off);
-            (void) new OptFixPCumulative(c,p2,u2,off);
-            (void) new OptFixPCumulative(c,p2,u3,off);
-            (void) new OptFixPCumulative(c,p2,u4,off);
-            (void) new OptFixPCumulative(c,p3,u1,off);
-            (void) new OptFixPCumulative(c,p3,u2,off);
-            (void) new OptFixPCumulative(c,p3,u3,off);
-            (void) new OptFixPCumulative(c,p3,u4,off);
-            (void) new OptFixPCumulative(c,p4,u1,off);
-            (void) new OptFixPCumulative(c,p4,u2,off);
-            (void) new OptFixPCumulative(c,p4,u3,off);
-            (void) new OptFixPCumulative(c,p4,u4,off);
+              (void) new OptFixPCumulative(c,p1,u1,off,icls[i]);
+              (void) new OptFixPCumulative(c,p1,u2,off,icls[i]);
+              (void) new OptFixPCumulative(c,p1,u3,off,icls[i]);
+              (void) new OptFixPCumulative(c,p1,u4,off,icls[i]);
+              (void) new OptFixPCumulative(c,p2,u1,off,icls[i]);
+              (void) new OptFixPCumulative(c,p2,u2,off,icls[i]);
+              (void) new OptFixPCumulative(c,p2,u3,off,icls[i]);
+              (void) new OptFixPCumulative(c,p2,u4,off,icls[i]);
+              (void) new OptFixPCumulative(c,p3,u1,off,icls[i]);
+              (void) new OptFixPCumulative(c,p3,u2,off,icls[i]);
+              (void) new OptFixPCumulative(c,p3,u3,off,icls[i]);
+              (void) new OptFixPCumulative(c,p3,u4,off,icls[i]);
+              (void) new OptFixPCumulative(c,p4,u1,off,icls[i]);
+              (void) new OptFixPCumulative(c,p4,u2,off,icls[i]);
+              (void) new OptFixPCumulative(c,p4,u3,off,icls[i]);
+              (void) new OptFixPCumulative(c,p4,u4,off,icls[i]);
 
-            (void) new OptFlexCumulative(c,0,1,u1,off);
-            (void) new OptFlexCumulative(c,0,1,u2,off);
-            (void) new OptFlexCumulative(c,0,1,u3,off);
-            (void) new OptFlexCumulative(c,0,1,u4,off);
-            (void) new OptFlexCumulative(c,0,2,u1,off);
-            (void) new OptFlexCumulative(c,0,2,u2,off);
-            (void) new OptFlexCumulative(c,0,2,u3,off);
-            (void) new OptFlexCumulative(c,0,2,u4,off);
-            (void) new OptFlexCumulative(c,3,5,u1,off);
-            (void) new OptFlexCumulative(c,3,5,u2,off);
-            (void) new OptFlexCumulative(c,3,5,u3,off);
-            (void) new OptFlexCumulative(c,3,5,u4,off);
+              (void) new OptFlexCumulative(c,0,1,u1,off,icls[i]);
+              (void) new OptFlexCumulative(c,0,1,u2,off,icls[i]);
+              (void) new OptFlexCumulative(c,0,1,u3,off,icls[i]);
+              (void) new OptFlexCumulative(c,0,1,u4,off,icls[i]);
+              (void) new OptFlexCumulative(c,0,2,u1,off,icls[i]);
+              (void) new OptFlexCumulative(c,0,2,u2,off,icls[i]);
+              (void) new OptFlexCumulative(c,0,2,u3,off,icls[i]);
+              (void) new OptFlexCumulative(c,0,2,u4,off,icls[i]);
+              (void) new OptFlexCumulative(c,3,5,u1,off,icls[i]);
+              (void) new OptFlexCumulative(c,3,5,u2,off,icls[i]);
+              (void) new OptFlexCumulative(c,3,5,u3,off,icls[i]);
+              (void) new OptFlexCumulative(c,3,5,u4,off,icls[i]);
 
-            off = Gecode::Int::Limits::min;
+              off = Gecode::Int::Limits::min;
+            }
           }
-        }
       }
     };
 
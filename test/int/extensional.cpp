@@ -524,6 +524,49 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test with large tuple set
+     class TupleSetLarge : public Test {
+       mutable Gecode::TupleSet t;
+     protected:
+       /// Extensional propagation kind
+       Gecode::ExtensionalPropKind epk;
+     public:
+       /// Create and register test
+       TupleSetLarge(Gecode::ExtensionalPropKind epk0, double prob)
+         : Test("Extensional::TupleSet::Large::"+str(epk0),
+                4,-2,2,false,Gecode::ICL_DOM), epk(epk0) {
+         using namespace Gecode;
+
+         CpltAssignment ass(4, IntSet(-2, 2));
+         while (ass()) {
+           if (Base::rand(100) <= prob*100) {
+             IntArgs tuple(4);
+             for (int i = 4; i--; ) tuple[i] = ass[i];
+             t.add(tuple);
+           }
+           ++ass;
+         }
+         t.finalize();
+       }
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         using namespace Gecode;
+         for (int i = 0; i < t.tuples(); ++i) {
+           TupleSet::Tuple l = t[i];
+           bool same = true;
+           for (int j = 0; j < t.arity() && same; ++j)
+             if (l[j] != x[j]) same = false;
+           if (same) return true;
+         }
+         return false;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         extensional(home, x, t, epk, ICL_DEF);
+       }
+     };
+
 
      RegSimpleA ra;
      RegSimpleB rb;
@@ -555,12 +598,19 @@ namespace Test { namespace Int {
 
      TupleSetA tsam(Gecode::EPK_MEMORY);
      TupleSetA tsas(Gecode::EPK_SPEED);
+     TupleSetA tsac(Gecode::EPK_COMPACT);
 
      TupleSetB tsbm(Gecode::EPK_MEMORY);
      TupleSetB tsbs(Gecode::EPK_SPEED);
+     TupleSetB tsbc(Gecode::EPK_COMPACT);
 
      TupleSetBool tsboolm(Gecode::EPK_MEMORY, 0.3);
      TupleSetBool tsbools(Gecode::EPK_SPEED, 0.3);
+     TupleSetBool tsboolc(Gecode::EPK_COMPACT, 0.3);
+
+     TupleSetLarge tslm(Gecode::EPK_MEMORY, 0.3);
+     TupleSetLarge tsls(Gecode::EPK_SPEED, 0.3);
+     TupleSetLarge tslc(Gecode::EPK_COMPACT, 0.3);
      //@}
 
    }
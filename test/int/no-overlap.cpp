@@ -59,9 +59,11 @@ namespace Test { namespace Int {
       Gecode::IntArgs h;
     public:
       /// Create and register test with maximal coordinate value \a m
-      Int2(int m, const Gecode::IntArgs& w0, const Gecode::IntArgs& h0) 
-        : Test("NoOverlap::Int::2::"+str(m)+"::"+str(w0)+"::"+str(h0),
-               2*w0.size(), 0, m-1), 
+      Int2(int m, const Gecode::IntArgs& w0, const Gecode::IntArgs& h0,
+           Gecode::IntConLevel icl) 
+        : Test("NoOverlap::Int::2::"+str(icl)+"::"+str(m)+"::"+
+               str(w0)+"::"+str(h0),
+               2*w0.size(), 0, m-1, false, icl), 
           w(w0), h(h0) {
       }
       /// %Test whether \a xy is solution
@@ -86,7 +88,7 @@ namespace Test { namespace Int {
         for (int i=0; i<n; i++) {
           x[i]=xy[2*i+0]; y[i]=xy[2*i+1];
         }
-        nooverlap(home, x, w, y, h);
+        nooverlap(home, x, w, y, h, icl);
       }
     };
     /// %Test for no-overlap with optional rectangles
@@ -136,8 +138,9 @@ namespace Test { namespace Int {
     class Var2 : public Test {
     public:
       /// Create and register test with maximal value \a m and \a n rectangles
-      Var2(int m, int n)
-        : Test("NoOverlap::Var::2::"+str(m)+"::"+str(n), 4*n, 0, m) {}
+      Var2(int m, int n, Gecode::IntConLevel icl)
+        : Test("NoOverlap::Var::2::"+str(icl)+"::"+str(m)+"::"+str(n), 
+               4*n, 0, m, false, icl) {}
       /// %Test whether \a xwyh is solution
       virtual bool solution(const Assignment& xwyh) const {
         int n = xwyh.size() / 4;
@@ -165,7 +168,7 @@ namespace Test { namespace Int {
           y0[i]=xwyh[4*i+2]; h[i]=xwyh[4*i+3];
           y1[i]=expr(home, y0[i] + h[i]);
         }
-        nooverlap(home, x0, w, x1, y0, h, y1);
+        nooverlap(home, x0, w, x1, y0, h, y1, icl);
       }
     };
     
@@ -271,20 +274,28 @@ namespace Test { namespace Int {
         IntArgs s3(4, 4,3,2,1);
         IntArgs s4(4, 1,1,1,1);
 
+        // Pairwise propagation (default) and sweeping (bounds)
+        IntConLevel icls[] = {ICL_DEF, ICL_BND};
+
+        for (int i=0; i<2; i++) {
+          for (int m=2; m<3; m++) {
+            (void) new Int2(m, s1, s1, icls[i]);
+            (void) new Int2(m, s2, s2, icls[i]);
+            (void) new Int2(m, s3, s3, icls[i]);
+            (void) new Int2(m, s2, s3, icls[i]);
+            (void) new Int2(m, s4, s4, icls[i]);
+            (void) new Int2(m, s4, s2, icls[i]);
+          }
+          (void) new Var2(2, 2, icls[i]);
+          (void) new Var2(3, 2, icls[i]);
+          (void) new Var2(1, 3, icls[i]);
+        }
+
         for (int m=2; m<3; m++) {
-          (void) new Int2(m, s1, s1);
-          (void) new Int2(m, s2, s2);
-          (void) new Int2(m, s3, s3);
-          (void) new Int2(m, s2, s3);
-          (void) new Int2(m, s4, s4);
-          (void) new Int2(m, s4, s2);
           (void) new IntOpt2(m, s2, s3);
           (void) new IntOpt2(m, s4, s3);
         }
 
-        (void) new Var2(2, 2);
-        (void) new Var2(3, 2);
-        (void) new Var2(1, 3);
         (void) new VarOpt2(2, 2);
         (void) new VarOpt2(3, 2);
         (void) new VarOptShared2(2, 2);
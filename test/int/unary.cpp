@@ -104,9 +104,10 @@ namespace Test { namespace Int {
        }
      public:
        /// Create and register test
-       OptFixPUnary(const Gecode::IntArgs& p0, int o)
-         : Test("Unary::Opt::Fix::"+str(o)+"::"+str(p0),
-                2*p0.size(),o,o+st(p0)), p(p0), l(o+st(p)/2) {
+       OptFixPUnary(const Gecode::IntArgs& p0, int o, 
+                    Gecode::IntConLevel icl0)
+         : Test("Unary::Opt::Fix::"+str(icl0)+"::"+str(o)+"::"+str(p0),
+                2*p0.size(),o,o+st(p0),false,icl0), p(p0), l(o+st(p)/2) {
          testsearch = false;
          contest = CTL_NONE;
        }
@@ -134,7 +135,7 @@ namespace Test { namespace Int {
            s[i]=x[i];
            m[i]=Gecode::expr(home, (x[n+i] > l));
          }
-         Gecode::unary(home, s, p, m);
+         Gecode::unary(home, s, p, m, icl);
        }
      };
 
@@ -209,10 +210,11 @@ namespace Test { namespace Int {
        }
      public:
        /// Create and register test
-       OptFlexUnary(int n, int minP, int maxP, int o)
-         : Test("Unary::Opt::Flex::"+str(o)+"::"+str(n)+"::"
+       OptFlexUnary(int n, int minP, int maxP, int o, 
+                    Gecode::IntConLevel icl0)
+         : Test("Unary::Opt::Flex::"+str(icl0)+"::"+str(o)+"::"+str(n)+"::"
                 +str(minP)+"::"+str(maxP),
-                3*n,0,n*maxP), _minP(minP), _maxP(maxP), off(o),
+                3*n,0,n*maxP,false,icl0), _minP(minP), _maxP(maxP), off(o),
                 l(n*maxP/2) {
          testsearch = false;
          testfix = false;
@@ -253,71 +255,95 @@ namespace Test { namespace Int {
          Gecode::BoolVarArgs m(n);
          for (int i=0; i<n; i++)
            m[i]=Gecode::expr(home, (x[n+i] > l));
-         Gecode::unary(home, s, px, e, m);
+         Gecode::unary(home, s, px, e, m, icl);
        }
      };
 
      Gecode::IntArgs p1(4, 2,2,2,2);
      ManFixPUnary mfu10(p1,0);
      ManFixPUnary mfu1i(p1,Gecode::Int::Limits::min);
-     OptFixPUnary ofu10(p1,0);
-     OptFixPUnary ofu1i(p1,Gecode::Int::Limits::min);
+     OptFixPUnary ofu10(p1,0,Gecode::ICL_DEF);
+     OptFixPUnary ofu10d(p1,0,Gecode::ICL_DOM);
+     OptFixPUnary ofu1i(p1,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFixPUnary ofu1id(p1,Gecode::Int::Limits::min,Gecode::ICL_DOM);
      ManFlexUnary mflu10(4,0,2,0);
      ManFlexUnary mflu1i(4,0,2,Gecode::Int::Limits::min);
      ManFlexUnary mflu101(4,1,3,0);
      ManFlexUnary mflu1i1(4,1,3,Gecode::Int::Limits::min);
-     OptFlexUnary oflu10(4,0,2,0);
-     OptFlexUnary oflu1i(4,0,2,Gecode::Int::Limits::min);
+     OptFlexUnary oflu10(4,0,2,0,Gecode::ICL_DEF);
+     OptFlexUnary oflu10d(4,0,2,0,Gecode::ICL_DOM);
+     OptFlexUnary oflu1i(4,0,2,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFlexUnary oflu1id(4,0,2,Gecode::Int::Limits::min,Gecode::ICL_DOM);
 
      Gecode::IntArgs p10(5, 2,2,0,2,2);
      ManFixPUnary mfu010(p10,0);
      ManFixPUnary mfu01i(p10,Gecode::Int::Limits::min);
-     OptFixPUnary ofu010(p10,0);
-     OptFixPUnary ofu01i(p10,Gecode::Int::Limits::min);
+     OptFixPUnary ofu010(p10,0,Gecode::ICL_DEF);
+     OptFixPUnary ofu010d(p10,0,Gecode::ICL_DOM);
+     OptFixPUnary ofu01i(p10,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFixPUnary ofu01id(p10,Gecode::Int::Limits::min,Gecode::ICL_DOM);
      ManFlexUnary mflu010(5,0,2,0);
      ManFlexUnary mflu01i(5,0,2,Gecode::Int::Limits::min);
-     OptFlexUnary oflu010(5,0,2,0);
-     OptFlexUnary oflu01i(5,0,2,Gecode::Int::Limits::min);
+     OptFlexUnary oflu010(5,0,2,0,Gecode::ICL_DEF);
+     OptFlexUnary oflu010d(5,0,2,0,Gecode::ICL_DOM);
+     OptFlexUnary oflu01i(5,0,2,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFlexUnary oflu01id(5,0,2,Gecode::Int::Limits::min,Gecode::ICL_DOM);
 
      Gecode::IntArgs p2(4, 4,3,3,5);
      ManFixPUnary mfu20(p2,0);
      ManFixPUnary mfu2i(p2,Gecode::Int::Limits::min);
-     OptFixPUnary ofu20(p2,0);
-     OptFixPUnary ofu2i(p2,Gecode::Int::Limits::min);
+     OptFixPUnary ofu20(p2,0,Gecode::ICL_DEF);
+     OptFixPUnary ofu20d(p2,0,Gecode::ICL_DOM);
+     OptFixPUnary ofu2i(p2,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFixPUnary ofu2id(p2,Gecode::Int::Limits::min,Gecode::ICL_DOM);
      ManFlexUnary mflu20(4,3,5,0);
      ManFlexUnary mflu2i(4,3,5,Gecode::Int::Limits::min);
-     OptFlexUnary oflu20(4,3,5,0);
-     OptFlexUnary oflu2i(4,3,5,Gecode::Int::Limits::min);
+     OptFlexUnary oflu20(4,3,5,0,Gecode::ICL_DEF);
+     OptFlexUnary oflu20d(4,3,5,0,Gecode::ICL_DOM);
+     OptFlexUnary oflu2i(4,3,5,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFlexUnary oflu2id(4,3,5,Gecode::Int::Limits::min,Gecode::ICL_DOM);
 
      Gecode::IntArgs p20(6, 4,0,3,3,0,5);
      ManFixPUnary mfu020(p20,0);
      ManFixPUnary mfu02i(p20,Gecode::Int::Limits::min);
-     OptFixPUnary ofu020(p20,0);
-     OptFixPUnary ofu02i(p20,Gecode::Int::Limits::min);
+     OptFixPUnary ofu020(p20,0,Gecode::ICL_DEF);
+     OptFixPUnary ofu020d(p20,0,Gecode::ICL_DOM);
+     OptFixPUnary ofu02i(p20,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFixPUnary ofu02id(p20,Gecode::Int::Limits::min,Gecode::ICL_DOM);
      ManFlexUnary mflu020(6,0,5,0);
      ManFlexUnary mflu02i(6,0,5,Gecode::Int::Limits::min);
-     OptFlexUnary oflu020(6,0,5,0);
-     OptFlexUnary oflu02i(6,0,5,Gecode::Int::Limits::min);
+     OptFlexUnary oflu020(6,0,5,0,Gecode::ICL_DEF);
+     OptFlexUnary oflu020d(6,0,5,0,Gecode::ICL_DOM);
+     OptFlexUnary oflu02i(6,0,5,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFlexUnary oflu02id(6,0,5,Gecode::Int::Limits::min,Gecode::ICL_DOM);
 
      Gecode::IntArgs p3(6, 4,2,9,3,7,5);
      ManFixPUnary mfu30(p3,0);
      ManFixPUnary mfu3i(p3,Gecode::Int::Limits::min);
-     OptFixPUnary ofu30(p3,0);
-     OptFixPUnary ofu3i(p3,Gecode::Int::Limits::min);
+     OptFixPUnary ofu30(p3,0,Gecode::ICL_DEF);
+     OptFixPUnary ofu30d(p3,0,Gecode::ICL_DOM);
+     OptFixPUnary ofu3i(p3,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFixPUnary ofu3id(p3,Gecode::Int::Limits::min,Gecode::ICL_DOM);
      ManFlexUnary mflu30(6,2,7,0);
      ManFlexUnary mflu3i(6,2,7,Gecode::Int::Limits::min);
-     OptFlexUnary oflu30(6,2,7,0);
-     OptFlexUnary oflu3i(6,2,7,Gecode::Int::Limits::min);
+     OptFlexUnary oflu30(6,2,7,0,Gecode::ICL_DEF);
+     OptFlexUnary oflu30d(6,2,7,0,Gecode::ICL_DOM);
+     OptFlexUnary oflu3i(6,2,7,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFlexUnary oflu3id(6,2,7,Gecode::Int::Limits::min,Gecode::ICL_DOM);
 
      Gecode::IntArgs p30(8, 4,0,2,9,3,7,5,0);
      ManFixPUnary mfu030(p30,0);
      ManFixPUnary mfu03i(p30,Gecode::Int::Limits::min);
-     OptFixPUnary ofu030(p30,0);
-     OptFixPUnary ofu03i(p30,Gecode::Int::Limits::min);
+     OptFixPUnary ofu030(p30,0,Gecode::ICL_DEF);
+     OptFixPUnary ofu030d(p30,0,Gecode::ICL_DOM);
+     OptFixPUnary ofu03i(p30,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFixPUnary ofu03id(p30,Gecode::Int::Limits::min,Gecode::ICL_DOM);
      ManFlexUnary mflu030(8,0,9,0);
      ManFlexUnary mflu03i(8,0,9,Gecode::Int::Limits::min);
-     OptFlexUnary oflu030(8,0,9,0);
-     OptFlexUnary oflu03i(8,0,9,Gecode::Int::Limits::min);
+     OptFlexUnary oflu030(8,0,9,0,Gecode::ICL_DEF);
+     OptFlexUnary oflu030d(8,0,9,0,Gecode::ICL_DOM);
+     OptFlexUnary oflu03i(8,0,9,Gecode::Int::Limits::min,Gecode::ICL_DEF);
+     OptFlexUnary oflu03id(8,0,9,Gecode::Int::Limits::min,Gecode::ICL_DOM);
 
      //@}
 
@@ -279,6 +279,12 @@ namespace Test {
       static std::string name(void) {
         return "Sol";
       }
+      /// Relax by fixing variables to their values in \a s
+      virtual bool relax(unsigned long int i, const Space& _s, double r) {
+        const HasSolutions& s = static_cast<const HasSolutions&>(_s);
+        Rnd rnd(static_cast<unsigned int>(i));
+        return Gecode::relax(*this, x, s.x, rnd, r, (i & 1) != 0);
+      }
       /// Rule out that solution is found more than once during restarts
       virtual void master(unsigned long int i, const Space* _s,
                           NoGoods&) {
@@ -317,6 +323,16 @@ namespace Test {
         GECODE_NEVER;
         return "";
       }
+      /// Map steal mode to string (empty for the default)
+      static std::string str(Gecode::Search::StealMode sm) {
+        switch (sm) {
+        case Gecode::Search::SM_PATH:  return "";
+        case Gecode::Search::SM_DEQUE: return "::Deque";
+        default: GECODE_NEVER;
+        }
+        GECODE_NEVER;
+        return "";
+      }
       /// Map constrain to string
       static std::string str(HowToConstrain htc) {
         switch (htc) {
@@ -348,14 +364,17 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// How idle threads find work
+      Gecode::Search::StealMode sm;
     public:
       /// Initialize test
       DFS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          Gecode::Search::StealMode sm0=Gecode::Search::SM_PATH)
         : Test("DFS::"+Model::name()+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+str(sm0),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0), sm(sm0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3);
@@ -364,6 +383,7 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.steal = sm;
         o.stop = &f;
         Gecode::DFS<Model> dfs(m,o);
         int n = m->solutions();
@@ -391,15 +411,18 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// How idle threads find work
+      Gecode::Search::StealMode sm;
     public:
       /// Initialize test
       BAB(HowToConstrain htc,
           HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          Gecode::Search::StealMode sm0=Gecode::Search::SM_PATH)
         : Test("BAB::"+Model::name()+"::"+str(htc)+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+str(sm0),
+               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0), sm(sm0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3,htc);
@@ -408,6 +431,7 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.steal = sm;
         o.stop = &f;
         Gecode::BAB<Model> bab(m,o);
         delete m;
@@ -462,6 +486,84 @@ namespace Test {
       }
     };
 
+    /// %Test for portfolio-based search
+    template<class Model, template<class> class Engine>
+    class PBS : public Test {
+    private:
+      /// Whether best solution search is performed
+      bool best;
+      /// Number of assets
+      unsigned int a;
+      /// Whether the first asset performs restart-based search
+      bool r;
+    public:
+      /// Initialize test
+      PBS(const std::string& e, HowToConstrain htc, unsigned int a0, bool r0)
+        : Test("PBS::"+e+"::"+Model::name()+"::"+str(htc)+"::"+str(a0)+
+               (r0 ? "::Restart" : ""),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY,htc),
+          best(e == "BAB"), a(a0), r(r0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.assets = a;
+        o.stop = &f;
+        if (r)
+          o.cutoff = Gecode::Search::Cutoff::geometric(1,2);
+        Gecode::PBS<Engine,Model> pbs(m,o);
+        int n = m->solutions();
+        delete m;
+        Model* b = NULL;
+        while (true) {
+          Model* s = pbs.next();
+          if (s != NULL) {
+            n--; delete b; b=s;
+          }
+          if ((s == NULL) && !pbs.stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        bool ok = best ? ((b == NULL) || b->best()) : (n == 0);
+        delete b;
+        return ok;
+      }
+    };
+
+    /// %Test for large neighbourhood search
+    template<class Model, template<class> class Engine>
+    class LNS : public Test {
+    public:
+      /// Initialize test
+      LNS(const std::string& e, HowToConstrain htc)
+        : Test("LNS::"+e+"::"+Model::name()+"::"+str(htc),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY,htc) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.stop = &f;
+        o.cutoff = Gecode::Search::Cutoff::geometric(1,2);
+        Gecode::LNS<Engine,Model> lns(m,o);
+        delete m;
+        Model* b = NULL;
+        while (true) {
+          Model* s = lns.next();
+          if (s != NULL) {
+            delete b; b=s;
+          }
+          if ((s == NULL) && !lns.stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        bool ok = (b == NULL) || b->best();
+        delete b;
+        return ok;
+      }
+    };
+
     /// Iterator for branching types
     class BranchTypes {
     private:
@@ -557,6 +659,28 @@ namespace Test {
               (void) new BAB<HasSolutions>
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
+        // Parallel search with work-stealing deques
+        for (unsigned int t = 2; t<=4; t++)
+          for (unsigned int c_d = 1; c_d<10; c_d+=8) {
+            unsigned int a_d = (c_d+1) / 2;
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3) {
+                  (void) new DFS<HasSolutions>
+                    (htb1.htb(),htb2.htb(),htb3.htb(),c_d,a_d,t,
+                     Gecode::Search::SM_DEQUE);
+                  for (ConstrainTypes htc; htc(); ++htc)
+                    (void) new BAB<HasSolutions>
+                      (htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
+                       c_d,a_d,t,Gecode::Search::SM_DEQUE);
+                }
+            (void) new DFS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE,
+                                          c_d, a_d, t,
+                                          Gecode::Search::SM_DEQUE);
+            (void) new BAB<SolveImmediate>
+              (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t,
+               Gecode::Search::SM_DEQUE);
+          }
         // Restart-based search
         for (unsigned int t = 1; t<=4; t++) {
           (void) new RBS<HasSolutions,Gecode::DFS>("DFS",t);
@@ -566,6 +690,27 @@ namespace Test {
           (void) new RBS<SolveImmediate,Gecode::DFS>("DFS",t);
           (void) new RBS<SolveImmediate,Gecode::BAB>("BAB",t);
         }
+        // Large neighbourhood search
+        for (ConstrainTypes htc; htc(); ++htc) {
+          (void) new LNS<HasSolutions,Gecode::DFS>("DFS",htc.htc());
+          (void) new LNS<HasSolutions,Gecode::BAB>("BAB",htc.htc());
+        }
+        (void) new LNS<FailImmediate,Gecode::DFS>("DFS",HTC_NONE);
+        (void) new LNS<FailImmediate,Gecode::BAB>("BAB",HTC_NONE);
+        (void) new LNS<SolveImmediate,Gecode::DFS>("DFS",HTC_NONE);
+        (void) new LNS<SolveImmediate,Gecode::BAB>("BAB",HTC_NONE);
+        // Portfolio-based search
+        for (unsigned int a = 1; a<=4; a++)
+          for (unsigned int r = 0; r<2; r++) {
+            (void) new PBS<HasSolutions,Gecode::DFS>("DFS",HTC_NONE,a,r>0);
+            (void) new PBS<FailImmediate,Gecode::DFS>("DFS",HTC_NONE,a,r>0);
+            (void) new PBS<SolveImmediate,Gecode::DFS>("DFS",HTC_NONE,a,r>0);
+            for (ConstrainTypes htc; htc(); ++htc)
+              (void) new PBS<HasSolutions,Gecode::BAB>
+                ("BAB",htc.htc(),a,r>0);
+            (void) new PBS<FailImmediate,Gecode::BAB>("BAB",HTC_NONE,a,r>0);
+            (void) new PBS<SolveImmediate,Gecode::BAB>("BAB",HTC_NONE,a,r>0);
+          }
       }
     };
 